@@ -0,0 +1,19 @@
+#version 450 core
+#extension GL_ARB_bindless_texture : require
+
+layout(location = 0) out vec4 o_Color;
+
+in vec4 v_Color;
+in vec2 v_TexCoords;
+flat in float v_TexIndex;
+in float v_TilingFactor;
+
+layout(std430, binding = 0) readonly buffer TextureTable
+{
+    sampler2D u_TextureHandles[];
+};
+
+void main()
+{
+    o_Color = texture(u_TextureHandles[int(v_TexIndex)], v_TexCoords * v_TilingFactor) * v_Color;
+}
@@ -0,0 +1,31 @@
+#version 450 core
+
+layout(location = 0) in vec2 u_Position;
+layout(location = 1) in vec4 u_Color;
+layout(location = 2) in vec2 u_TexCoords;
+layout(location = 3) in uint u_DepthTexIndex;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    float u_Time;
+};
+
+out vec4 v_Color;
+out vec2 v_TexCoords;
+flat out float v_TexIndex;
+out float v_TilingFactor;
+
+void main()
+{
+    float depth = unpackHalf2x16(u_DepthTexIndex >> 16).x;
+
+    v_Color = u_Color;
+    v_TexCoords = u_TexCoords;
+    v_TexIndex = float(u_DepthTexIndex & 0xFFFFu);
+    v_TilingFactor = 1.0;
+
+    gl_Position = u_ViewProjection * vec4(u_Position, depth, 1.0);
+}
@@ -0,0 +1,40 @@
+#version 450 core
+
+layout(location = 0) in vec3 u_Position;
+layout(location = 1) in vec2 u_Size;
+layout(location = 2) in float u_Rotation;
+layout(location = 3) in vec4 u_Color;
+layout(location = 4) in vec4 u_TexRect;
+layout(location = 5) in float u_TexIndex;
+layout(location = 6) in float u_TilingFactor;
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    float u_Time;
+};
+
+out vec4 v_Color;
+out vec2 v_TexCoords;
+flat out float v_TexIndex;
+out float v_TilingFactor;
+
+const vec2 QUAD_CORNERS[4] = vec2[4](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+const vec2 QUAD_TEX_CORNERS[4] = vec2[4](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+void main()
+{
+    vec2 corner = QUAD_CORNERS[gl_VertexID] * u_Size;
+    float s = sin(u_Rotation);
+    float c = cos(u_Rotation);
+    vec2 rotated = vec2(corner.x * c - corner.y * s, corner.x * s + corner.y * c);
+
+    v_Color = u_Color;
+    v_TexCoords = mix(u_TexRect.xy, u_TexRect.zw, QUAD_TEX_CORNERS[gl_VertexID]);
+    v_TexIndex = u_TexIndex;
+    v_TilingFactor = u_TilingFactor;
+
+    gl_Position = u_ViewProjection * vec4(u_Position.xy + rotated, u_Position.z, 1.0);
+}
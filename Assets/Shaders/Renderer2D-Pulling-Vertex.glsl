@@ -0,0 +1,53 @@
+#version 450 core
+
+struct PackedQuad
+{
+    vec3 Position;
+    float Rotation;
+    vec2 Size;
+    uint Color;
+    uint TexIndex;
+    uvec2 TexRect;
+    float TilingFactor;
+    float Padding;
+};
+
+layout(std430, binding = 1) readonly buffer QuadBuffer
+{
+    PackedQuad u_Quads[];
+};
+
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    float u_Time;
+};
+
+out vec4 v_Color;
+out vec2 v_TexCoords;
+flat out float v_TexIndex;
+out float v_TilingFactor;
+
+const int QUAD_INDICES[6] = int[6](0, 1, 2, 2, 3, 0);
+const vec2 QUAD_CORNERS[4] = vec2[4](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+const vec2 QUAD_TEX_CORNERS[4] = vec2[4](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+void main()
+{
+    PackedQuad quad = u_Quads[gl_VertexID / 6];
+    int vertex = QUAD_INDICES[gl_VertexID % 6];
+
+    vec2 corner = QUAD_CORNERS[vertex] * quad.Size;
+    float s = sin(quad.Rotation);
+    float c = cos(quad.Rotation);
+    vec2 rotated = vec2(corner.x * c - corner.y * s, corner.x * s + corner.y * c);
+
+    v_Color = unpackUnorm4x8(quad.Color);
+    v_TexCoords = mix(unpackHalf2x16(quad.TexRect.x), unpackHalf2x16(quad.TexRect.y), QUAD_TEX_CORNERS[vertex]);
+    v_TexIndex = float(quad.TexIndex);
+    v_TilingFactor = quad.TilingFactor;
+
+    gl_Position = u_ViewProjection * vec4(quad.Position.xy + rotated, quad.Position.z, 1.0);
+}
@@ -0,0 +1,16 @@
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in vec4 v_Color;
+in vec2 v_TexCoords;
+flat in float v_TexIndex;
+in float v_TilingFactor;
+
+uniform sampler2DArray u_Textures[32];
+
+void main()
+{
+    int index = int(v_TexIndex);
+    o_Color = texture(u_Textures[index >> 6], vec3(v_TexCoords * v_TilingFactor, float(index & 63))) * v_Color;
+}
@@ -1,5 +1,9 @@
 #include "GLFW_Window.hpp"
 #include "Renderer.hpp"
+#include "Instrument.hpp"
+#include "FrameStats.hpp"
+#include "GPUProfiler.hpp"
+#include "TextureLoader.hpp"
 
 namespace TE::APIs::GLFW
 {
@@ -101,9 +105,18 @@ namespace TE::APIs::GLFW
             glfwDestroyWindow(m_NativeWindow);
     }
 
+    // The swap closes the frame, so the per-frame hooks run once the Swap stage has been timed.
     void GLFWAPI_Window::SwapBuffers()
     {
-        if(m_Specification.IsActive && m_Specification.IsVSyncEnabled)
-            m_Context->SwapBuffers();
+        {
+            TE::Core::FrameStageScope swap_stage(TE::Core::FrameStage::Swap);
+            if(m_Specification.IsActive && m_Specification.IsVSyncEnabled)
+                m_Context->SwapBuffers();
+        }
+
+        TE_PROFILE_FRAME();
+        TE_GPU_PROFILE_FRAME();
+        TE::Core::FrameStats::BeginFrame();
+        TE::Renderer::TextureLoader::Update();
     }
 }
\ No newline at end of file
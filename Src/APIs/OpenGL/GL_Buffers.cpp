@@ -1,4 +1,8 @@
+#include <cstring>
+
 #include "GL_Buffers.hpp"
+#include "GL_StateCache.hpp"
+#include "Asserts.hpp"
 
 
 namespace TE::APIs::OpenGL
@@ -17,22 +21,23 @@ namespace TE::APIs::OpenGL
 
     GL_VertexBuffer::~GL_VertexBuffer()
     {
+        GL_StateCache::ForgetBuffer(m_VertexBufferID);
         glDeleteBuffers(1, &m_VertexBufferID);
     }
 
     void GL_VertexBuffer::Bind() const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, m_VertexBufferID);
+        GL_StateCache::BindBuffer(GL_ARRAY_BUFFER, m_VertexBufferID);
     }
 
     void GL_VertexBuffer::Unbind() const
     {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        GL_StateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
-    void GL_VertexBuffer::SetData(const void* data, UInt32 size)
+    void GL_VertexBuffer::SetData(const void* data, UInt32 size, UInt32 offset)
     {
-        glNamedBufferSubData(m_VertexBufferID, 0, size, data);
+        glNamedBufferSubData(m_VertexBufferID, offset, size, data);
     }
 
     void GL_VertexBuffer::SetLayout(const TE::Renderer::BufferLayout& layout)
@@ -40,6 +45,113 @@ namespace TE::APIs::OpenGL
         m_Layout = layout;
     }
 
+    static const GLbitfield STREAM_BUFFER_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    static const GLuint64 STREAM_FENCE_TIMEOUT = 1000000;
+
+    GL_StreamVertexBuffer::GL_StreamVertexBuffer(UInt32 capacity) : m_Capacity(capacity)
+    {
+        glCreateBuffers(1, &m_VertexBufferID);
+        glNamedBufferStorage(m_VertexBufferID, m_Capacity, nullptr, STREAM_BUFFER_FLAGS);
+        m_MappedData = static_cast<UInt8*>(glMapNamedBufferRange(m_VertexBufferID, 0, m_Capacity, STREAM_BUFFER_FLAGS));
+        TRIMANA_ASSERT(m_MappedData, "Failed to map stream vertex buffer");
+    }
+
+    GL_StreamVertexBuffer::~GL_StreamVertexBuffer()
+    {
+        for(auto& fence : m_Fences)
+            glDeleteSync(fence.Sync);
+
+        glUnmapNamedBuffer(m_VertexBufferID);
+        GL_StateCache::ForgetBuffer(m_VertexBufferID);
+        glDeleteBuffers(1, &m_VertexBufferID);
+    }
+
+    Boolean GL_StreamVertexBuffer::IsSupported()
+    {
+        return GLAD_GL_VERSION_4_5 || (GLAD_GL_ARB_buffer_storage && GLAD_GL_ARB_direct_state_access);
+    }
+
+    void GL_StreamVertexBuffer::Bind() const
+    {
+        GL_StateCache::BindBuffer(GL_ARRAY_BUFFER, m_VertexBufferID);
+    }
+
+    void GL_StreamVertexBuffer::Unbind() const
+    {
+        GL_StateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void GL_StreamVertexBuffer::SetData(const void* data, UInt32 size, UInt32 offset)
+    {
+        std::memcpy(static_cast<UInt8*>(Reserve(offset + size)) + offset, data, size);
+    }
+
+    void GL_StreamVertexBuffer::SetLayout(const TE::Renderer::BufferLayout& layout)
+    {
+        m_Layout = layout;
+    }
+
+    // The head only moves forward; a reservation that would straddle the end of the buffer starts over
+    // at offset zero, and the bytes it covers were last written one capacity earlier.
+    void* GL_StreamVertexBuffer::Reserve(UInt32 size)
+    {
+        TRIMANA_ASSERT(size <= m_Capacity, "Stream vertex buffer reservation exceeds its capacity");
+
+        UInt32 offset = GetReservedOffset();
+        if(offset + size > m_Capacity)
+            m_Head += m_Capacity - offset;
+
+        if(m_Head + size > m_Capacity + m_Retired)
+            WaitFor(m_Head + size - m_Capacity);
+
+        return m_MappedData + GetReservedOffset();
+    }
+
+    void GL_StreamVertexBuffer::Release(UInt32 size)
+    {
+        m_Head += size;
+    }
+
+    void GL_StreamVertexBuffer::Fence()
+    {
+        if(!m_Fences.empty() && m_Fences.back().Position == m_Head)
+            return;
+
+        m_Fences.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_Head });
+    }
+
+    void GL_StreamVertexBuffer::BindStorage(UInt32 binding) const
+    {
+        GL_StateCache::BindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_VertexBufferID);
+    }
+
+    // Blocks until the GPU has consumed every byte written before `position`. A fence covers all writes
+    // issued before it, so older fences are dropped without waiting. When those bytes belong to the
+    // frame still being recorded no fence covers them yet and one is placed on the spot.
+    void GL_StreamVertexBuffer::WaitFor(UInt64 position)
+    {
+        while(!m_Fences.empty() && m_Fences.front().Position < position)
+        {
+            if(m_Fences.size() == 1)
+                Fence();
+
+            glDeleteSync(m_Fences.front().Sync);
+            m_Fences.pop_front();
+        }
+
+        if(m_Fences.empty())
+            Fence();
+
+        GLsync fence = m_Fences.front().Sync;
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        while(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED && status != GL_WAIT_FAILED)
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, STREAM_FENCE_TIMEOUT);
+
+        m_Retired = m_Fences.front().Position;
+        glDeleteSync(fence);
+        m_Fences.pop_front();
+    }
+
     GL_IndexBuffer::GL_IndexBuffer(IndexBufferData data, UInt32 indicesCount)
     {
         glCreateBuffers(1, &m_IndexBufferID);
@@ -49,17 +161,191 @@ namespace TE::APIs::OpenGL
 
     GL_IndexBuffer::~GL_IndexBuffer()
     {
+        GL_StateCache::ForgetBuffer(m_IndexBufferID);
         glDeleteBuffers(1, &m_IndexBufferID);
     }
 
     void GL_IndexBuffer::Bind() const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBufferID);
+        GL_StateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBufferID);
     }
 
     void GL_IndexBuffer::Unbind() const
     {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        GL_StateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    GL_StorageBuffer::GL_StorageBuffer(UInt32 size) : m_Size(size)
+    {
+        glCreateBuffers(1, &m_StorageBufferID);
+        glNamedBufferData(m_StorageBufferID, size, nullptr, GL_DYNAMIC_DRAW);
+    }
+
+    GL_StorageBuffer::~GL_StorageBuffer()
+    {
+        GL_StateCache::ForgetBuffer(m_StorageBufferID);
+        glDeleteBuffers(1, &m_StorageBufferID);
+    }
+
+    void GL_StorageBuffer::Bind(UInt32 binding) const
+    {
+        GL_StateCache::BindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_StorageBufferID);
+    }
+
+    void GL_StorageBuffer::Unbind(UInt32 binding) const
+    {
+        GL_StateCache::BindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    }
+
+    void GL_StorageBuffer::SetData(const void* data, UInt32 size, UInt32 offset)
+    {
+        TRIMANA_ASSERT(offset + size <= m_Size, "Storage buffer overflow");
+        glNamedBufferSubData(m_StorageBufferID, offset, size, data);
+    }
+
+    static const UInt64 STAGING_ALIGNMENT = 16;
+
+    GL_StagingBuffer::GL_StagingBuffer(UInt64 capacity) : m_Capacity(capacity)
+    {
+        glCreateBuffers(1, &m_StagingBufferID);
+        glNamedBufferStorage(m_StagingBufferID, m_Capacity, nullptr, STREAM_BUFFER_FLAGS);
+        m_MappedData = static_cast<UInt8*>(glMapNamedBufferRange(m_StagingBufferID, 0, m_Capacity, STREAM_BUFFER_FLAGS));
+        TRIMANA_ASSERT(m_MappedData, "Failed to map staging buffer");
+    }
+
+    GL_StagingBuffer::~GL_StagingBuffer()
+    {
+        for(auto& fence : m_Fences)
+            glDeleteSync(fence.Sync);
+
+        glUnmapNamedBuffer(m_StagingBufferID);
+        GL_StateCache::ForgetBuffer(m_StagingBufferID);
+        glDeleteBuffers(1, &m_StagingBufferID);
+    }
+
+    Boolean GL_StagingBuffer::IsSupported()
+    {
+        return GL_StreamVertexBuffer::IsSupported();
+    }
+
+    void GL_StagingBuffer::Bind() const
+    {
+        GL_StateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, m_StagingBufferID);
+    }
+
+    void GL_StagingBuffer::Unbind() const
+    {
+        GL_StateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    // Ranges are handed out in ring order from any thread but may be consumed out of order, so the tail
+    // only moves past a range once it and every range before it have been read and fenced.
+    void* GL_StagingBuffer::Allocate(UInt64 size, UInt64& offset)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        size = (size + STAGING_ALIGNMENT - 1) & ~(STAGING_ALIGNMENT - 1);
+        if(size > m_Capacity)
+            return nullptr;
+
+        UInt64 position = m_Head;
+        if(position % m_Capacity + size > m_Capacity)
+            position += m_Capacity - position % m_Capacity;
+
+        if(position + size - m_Tail > m_Capacity)
+            return nullptr;
+
+        offset = position % m_Capacity;
+        m_Ranges.push_back({ m_Head, position + size, offset });
+        m_Head = position + size;
+        return m_MappedData + offset;
+    }
+
+    void GL_StagingBuffer::Consume(UInt64 offset)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for(auto& range : m_Ranges)
+        {
+            if(!range.Consumed && range.Offset == offset)
+            {
+                range.Consumed = TE_TRUE;
+                return;
+            }
+        }
+    }
+
+    // Call once per frame on the render thread: one fence covers every range consumed since the last
+    // call, and ranges behind signalled fences are returned to the ring without ever blocking.
+    void GL_StagingBuffer::Fence()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        Boolean fenced = TE_FALSE;
+        for(auto& range : m_Ranges)
+        {
+            if(range.Consumed && !range.FenceSerial)
+            {
+                range.FenceSerial = m_NextFenceSerial;
+                fenced = TE_TRUE;
+            }
+        }
+
+        if(fenced)
+            m_Fences.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), m_NextFenceSerial++ });
+
+        while(!m_Fences.empty())
+        {
+            GLenum status = glClientWaitSync(m_Fences.front().Sync, 0, 0);
+            if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                break;
+
+            m_CompletedSerial = m_Fences.front().Serial;
+            glDeleteSync(m_Fences.front().Sync);
+            m_Fences.pop_front();
+        }
+
+        while(!m_Ranges.empty() && m_Ranges.front().FenceSerial && m_Ranges.front().FenceSerial <= m_CompletedSerial)
+        {
+            m_Tail = m_Ranges.front().End;
+            m_Ranges.pop_front();
+        }
+    }
+
+    GL_UniformBuffer::GL_UniformBuffer(UInt32 size) : m_Size(size)
+    {
+        m_OffsetAlignment = QueryOffsetAlignment();
+
+        glCreateBuffers(1, &m_UniformBufferID);
+        glNamedBufferData(m_UniformBufferID, size, nullptr, GL_DYNAMIC_DRAW);
+    }
+
+    UInt32 GL_UniformBuffer::QueryOffsetAlignment()
+    {
+        GLint alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        return static_cast<UInt32>(alignment > 0 ? alignment : 256);
+    }
+
+    GL_UniformBuffer::~GL_UniformBuffer()
+    {
+        GL_StateCache::ForgetBuffer(m_UniformBufferID);
+        glDeleteBuffers(1, &m_UniformBufferID);
+    }
+
+    void GL_UniformBuffer::Bind(UInt32 binding) const
+    {
+        GL_StateCache::BindBufferBase(GL_UNIFORM_BUFFER, binding, m_UniformBufferID);
+    }
+
+    void GL_UniformBuffer::BindRange(UInt32 binding, UInt32 offset, UInt32 size) const
+    {
+        TRIMANA_ASSERT(offset % m_OffsetAlignment == 0, "Uniform buffer range is not aligned");
+        GL_StateCache::BindBufferRange(GL_UNIFORM_BUFFER, binding, m_UniformBufferID, offset, size);
+    }
+
+    void GL_UniformBuffer::SetData(const void* data, UInt32 size, UInt32 offset)
+    {
+        TRIMANA_ASSERT(offset + size <= m_Size, "Uniform buffer overflow");
+        glNamedBufferSubData(m_UniformBufferID, offset, size, data);
     }
 
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <deque>
+#include <mutex>
+#include <vector>
 #include <glad/glad.h>
 
 #include "TypeDef.hpp"
@@ -18,7 +21,7 @@ namespace TE::APIs::OpenGL
             virtual void Bind() const override;
             virtual void Unbind() const override;
             virtual VertexBufferID GetID() const override { return m_VertexBufferID; }
-            virtual void SetData(const void* data, UInt32 size) override;
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) override;
             virtual void SetLayout(const TE::Renderer::BufferLayout& layout) override;
             virtual const TE::Renderer::BufferLayout& GetLayout() const override { return m_Layout; }
 
@@ -27,6 +30,47 @@ namespace TE::APIs::OpenGL
             TE::Renderer::BufferLayout m_Layout;
     };
 
+    struct GL_StreamFence
+    {
+        GLsync Sync{nullptr};
+        UInt64 Position{TE_NULL};
+    };
+
+    class GL_StreamVertexBuffer : public TE::Renderer::StreamVertexBuffer
+    {
+        public:
+            GL_StreamVertexBuffer(UInt32 capacity);
+            virtual ~GL_StreamVertexBuffer();
+
+            static Boolean IsSupported();
+
+            virtual void Bind() const override;
+            virtual void Unbind() const override;
+            virtual VertexBufferID GetID() const override { return m_VertexBufferID; }
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) override;
+            virtual void SetLayout(const TE::Renderer::BufferLayout& layout) override;
+            virtual const TE::Renderer::BufferLayout& GetLayout() const override { return m_Layout; }
+
+            virtual void* Reserve(UInt32 size) override;
+            virtual void Release(UInt32 size) override;
+            virtual void Fence() override;
+            virtual void BindStorage(UInt32 binding) const override;
+            virtual UInt32 GetReservedOffset() const override { return static_cast<UInt32>(m_Head % m_Capacity); }
+            virtual UInt32 GetCapacity() const override { return m_Capacity; }
+
+        private:
+            void WaitFor(UInt64 position);
+
+        private:
+            VertexBufferID m_VertexBufferID{TE_NULL};
+            TE::Renderer::BufferLayout m_Layout;
+            UInt8* m_MappedData{nullptr};
+            UInt32 m_Capacity{TE_NULL};
+            UInt64 m_Head{TE_NULL};
+            UInt64 m_Retired{TE_NULL};
+            std::deque<GL_StreamFence> m_Fences;
+    };
+
     class GL_IndexBuffer : public TE::Renderer::IndexBuffer
     {
         public:
@@ -43,4 +87,87 @@ namespace TE::APIs::OpenGL
             IndexBufferID m_IndexBufferID{TE_NULL};
             UInt32 m_Count{TE_NULL};
     };
+
+    class GL_StorageBuffer : public TE::Renderer::StorageBuffer
+    {
+        public:
+            GL_StorageBuffer() = default;
+            GL_StorageBuffer(UInt32 size);
+            virtual ~GL_StorageBuffer();
+
+            virtual void Bind(UInt32 binding) const override;
+            virtual void Unbind(UInt32 binding) const override;
+            virtual StorageBufferID GetID() const override { return m_StorageBufferID; }
+            virtual UInt32 GetSize() const override { return m_Size; }
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) override;
+
+        private:
+            StorageBufferID m_StorageBufferID{TE_NULL};
+            UInt32 m_Size{TE_NULL};
+    };
+
+    struct GL_StagingRange
+    {
+        UInt64 Begin{TE_NULL};
+        UInt64 End{TE_NULL};
+        UInt64 Offset{TE_NULL};
+        UInt64 FenceSerial{TE_NULL};
+        Boolean Consumed{TE_FALSE};
+    };
+
+    struct GL_StagingFence
+    {
+        GLsync Sync{nullptr};
+        UInt64 Serial{TE_NULL};
+    };
+
+    class GL_StagingBuffer : public TE::Renderer::StagingBuffer
+    {
+        public:
+            GL_StagingBuffer(UInt64 capacity);
+            virtual ~GL_StagingBuffer();
+
+            static Boolean IsSupported();
+
+            virtual void Bind() const override;
+            virtual void Unbind() const override;
+            virtual StagingBufferID GetID() const override { return m_StagingBufferID; }
+            virtual UInt64 GetCapacity() const override { return m_Capacity; }
+            virtual void* Allocate(UInt64 size, UInt64& offset) override;
+            virtual void Consume(UInt64 offset) override;
+            virtual void Fence() override;
+
+        private:
+            StagingBufferID m_StagingBufferID{TE_NULL};
+            UInt8* m_MappedData{nullptr};
+            UInt64 m_Capacity{TE_NULL};
+            UInt64 m_Head{TE_NULL};
+            UInt64 m_Tail{TE_NULL};
+            UInt64 m_NextFenceSerial{1};
+            UInt64 m_CompletedSerial{TE_NULL};
+            std::deque<GL_StagingRange> m_Ranges;
+            std::deque<GL_StagingFence> m_Fences;
+            std::mutex m_Mutex;
+    };
+
+    class GL_UniformBuffer : public TE::Renderer::UniformBuffer
+    {
+        public:
+            GL_UniformBuffer(UInt32 size);
+            virtual ~GL_UniformBuffer();
+
+            static UInt32 QueryOffsetAlignment();
+
+            virtual void Bind(UInt32 binding) const override;
+            virtual void BindRange(UInt32 binding, UInt32 offset, UInt32 size) const override;
+            virtual UniformBufferID GetID() const override { return m_UniformBufferID; }
+            virtual UInt32 GetSize() const override { return m_Size; }
+            virtual UInt32 GetOffsetAlignment() const override { return m_OffsetAlignment; }
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) override;
+
+        private:
+            UniformBufferID m_UniformBufferID{TE_NULL};
+            UInt32 m_Size{TE_NULL};
+            UInt32 m_OffsetAlignment{TE_NULL};
+    };
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "GL_FrameBuffer.hpp"
+#include "GL_StateCache.hpp"
 #include "Asserts.hpp"
 
 namespace TE::APIs::OpenGL
@@ -11,6 +12,9 @@ namespace TE::APIs::OpenGL
 
     GL_FrameBuffer::~GL_FrameBuffer()
     {
+        GL_StateCache::ForgetFrameBuffer(m_FrameBufferID);
+        GL_StateCache::ForgetTexture(m_DepthAttachment);
+        GL_StateCache::ForgetTexture(m_ColorAttachment);
         glDeleteFramebuffers(1, &m_FrameBufferID);
         glDeleteTextures(1, &m_DepthAttachment);
         glDeleteTextures(1, &m_ColorAttachment);
@@ -18,13 +22,13 @@ namespace TE::APIs::OpenGL
 
     void GL_FrameBuffer::Bind() const
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, m_FrameBufferID);
-		glViewport(0, 0, m_Specification.Width, m_Specification.Height);
+        GL_StateCache::BindFrameBuffer(m_FrameBufferID);
+		GL_StateCache::Viewport(0, 0, m_Specification.Width, m_Specification.Height);
     }
 
     void GL_FrameBuffer::Unbind() const
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        GL_StateCache::BindFrameBuffer(0);
     }
 
     void GL_FrameBuffer::ResizeFrame(UInt32 width, UInt32 height)
@@ -32,18 +36,18 @@ namespace TE::APIs::OpenGL
         m_Specification.Width = width;
         m_Specification.Height = height;
 
-        glBindFramebuffer(GL_FRAMEBUFFER, m_FrameBufferID);
+        GL_StateCache::BindFrameBuffer(m_FrameBufferID);
 
-        glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
+        GL_StateCache::BindTexture(GL_TEXTURE_2D, m_ColorAttachment);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Specification.Width, m_Specification.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachment, 0);
 
-        glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
+        GL_StateCache::BindTexture(GL_TEXTURE_2D, m_DepthAttachment);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
 
 		TRIMANA_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		GL_StateCache::BindFrameBuffer(0);
     }
 
     FrameBufferID GL_FrameBuffer::GetFrameBufferID() const
@@ -64,10 +68,10 @@ namespace TE::APIs::OpenGL
     void GL_FrameBuffer::CreateFrame()
     {
         glCreateFramebuffers(1, &m_FrameBufferID);
-		glBindFramebuffer(GL_FRAMEBUFFER, m_FrameBufferID);
+		GL_StateCache::BindFrameBuffer(m_FrameBufferID);
 
         glCreateTextures(GL_TEXTURE_2D, 1, &m_ColorAttachment);
-        glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
+        GL_StateCache::BindTexture(GL_TEXTURE_2D, m_ColorAttachment);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Specification.Width, m_Specification.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -76,12 +80,12 @@ namespace TE::APIs::OpenGL
 		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachment, 0);
 
         glCreateTextures(GL_TEXTURE_2D, 1, &m_DepthAttachment);
-        glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
+        GL_StateCache::BindTexture(GL_TEXTURE_2D, m_DepthAttachment);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
 
 		TRIMANA_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		GL_StateCache::BindFrameBuffer(0);
     }
 
 
@@ -0,0 +1,151 @@
+#include <array>
+
+#include "GL_GPUProfiler.hpp"
+#include "Profiler.hpp"
+#include "Asserts.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    struct GL_GPUProfilerData
+    {
+        std::array<GL_GPUFrameQueries, GPU_PROFILER_FRAME_LATENCY> Frames;
+        UInt32 FrameIndex{ TE_NULL };
+        UInt64 DroppedFrames{ TE_NULL };
+        UInt64 DroppedScopes{ TE_NULL };
+        Boolean Initialized{ TE_FALSE };
+
+    }; static GL_GPUProfilerData s_GPUProfilerData;
+
+    static const UInt32 INVALID_GPU_SCOPE = 0xFFFFFFFF;
+
+    void GL_GPUProfiler::Init()
+    {
+        s_GPUProfilerData.FrameIndex = TE_NULL;
+        s_GPUProfilerData.DroppedFrames = TE_NULL;
+        s_GPUProfilerData.DroppedScopes = TE_NULL;
+        s_GPUProfilerData.Initialized = TE_TRUE;
+    }
+
+    void GL_GPUProfiler::Shutdown()
+    {
+        for(auto& frame : s_GPUProfilerData.Frames)
+        {
+            if(!frame.Queries.empty())
+                glDeleteQueries(static_cast<GLsizei>(frame.Queries.size()), frame.Queries.data());
+
+            frame = GL_GPUFrameQueries{};
+        }
+
+        if(s_GPUProfilerData.DroppedFrames)
+            TE_CORE_WARN("GPU profiler dropped {0} frames whose queries were still in flight", s_GPUProfilerData.DroppedFrames);
+
+        if(s_GPUProfilerData.DroppedScopes)
+            TE_CORE_WARN("GPU profiler dropped {0} scopes over the per-frame query limit, is TE_GPU_PROFILE_FRAME() called every frame?", s_GPUProfilerData.DroppedScopes);
+
+        s_GPUProfilerData.Initialized = TE_FALSE;
+    }
+
+    void GL_GPUProfiler::BeginFrame()
+    {
+        if(!s_GPUProfilerData.Initialized)
+            return;
+
+        s_GPUProfilerData.FrameIndex = (s_GPUProfilerData.FrameIndex + 1) % GPU_PROFILER_FRAME_LATENCY;
+        Resolve(s_GPUProfilerData.Frames[s_GPUProfilerData.FrameIndex]);
+    }
+
+    UInt32 GL_GPUProfiler::BeginScope(CString name)
+    {
+        if(!s_GPUProfilerData.Initialized || !TE::Core::Profiler::IsActive())
+            return INVALID_GPU_SCOPE;
+
+        GL_GPUFrameQueries& frame = s_GPUProfilerData.Frames[s_GPUProfilerData.FrameIndex];
+
+        // The pool only recycles on BeginFrame(); without it every scope would grow the slot forever.
+        if(frame.NextQuery + 2 > GPU_PROFILER_MAX_QUERIES)
+        {
+            s_GPUProfilerData.DroppedScopes++;
+            return INVALID_GPU_SCOPE;
+        }
+
+        // GL_TIMESTAMP runs on its own clock; sampling both clocks once per frame keeps the drift
+        // between them far below the resolution anyone reads a trace at.
+        if(frame.Scopes.empty())
+        {
+            GLint64 gpu_now = 0;
+            glGetInteger64v(GL_TIMESTAMP, &gpu_now);
+            frame.ClockOffset = static_cast<Int64>(TE::Core::Profiler::Now()) - gpu_now;
+        }
+
+        GL_GPUScopeRecord scope{ name, AcquireQuery(frame), TE_NULL, TE::Core::Profiler::NewFlowID() };
+        glQueryCounter(scope.BeginQuery, GL_TIMESTAMP);
+        TE::Core::Profiler::FlowBegin(name, scope.FlowID);
+
+        frame.Scopes.emplace_back(scope);
+        return static_cast<UInt32>(frame.Scopes.size() - 1);
+    }
+
+    void GL_GPUProfiler::EndScope(UInt32 scope)
+    {
+        GL_GPUFrameQueries& frame = s_GPUProfilerData.Frames[s_GPUProfilerData.FrameIndex];
+        if(scope == INVALID_GPU_SCOPE || scope >= frame.Scopes.size())
+            return;
+
+        frame.Scopes[scope].EndQuery = AcquireQuery(frame);
+        glQueryCounter(frame.Scopes[scope].EndQuery, GL_TIMESTAMP);
+    }
+
+    UInt64 GL_GPUProfiler::GetDroppedFrames()
+    {
+        return s_GPUProfilerData.DroppedFrames;
+    }
+
+    UInt64 GL_GPUProfiler::GetDroppedScopes()
+    {
+        return s_GPUProfilerData.DroppedScopes;
+    }
+
+    // The last query issued in a frame completes last, so its availability covers the whole frame. If
+    // the GPU is still more than GPU_PROFILER_FRAME_LATENCY frames behind, the frame is dropped rather
+    // than stalling on GL_QUERY_RESULT.
+    void GL_GPUProfiler::Resolve(GL_GPUFrameQueries& frame)
+    {
+        if(!frame.Scopes.empty())
+        {
+            GLint available = GL_FALSE;
+            glGetQueryObjectiv(frame.Queries[frame.NextQuery - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if(available != GL_TRUE)
+            {
+                s_GPUProfilerData.DroppedFrames++;
+            }
+            else if(TE::Core::Profiler::IsActive())
+            {
+                for(auto& scope : frame.Scopes)
+                {
+                    if(!scope.EndQuery)
+                        continue;
+
+                    GLuint64 begin = 0;
+                    GLuint64 end = 0;
+                    glGetQueryObjectui64v(scope.BeginQuery, GL_QUERY_RESULT, &begin);
+                    glGetQueryObjectui64v(scope.EndQuery, GL_QUERY_RESULT, &end);
+                    TE::Core::Profiler::RecordGPU(scope.Name, begin + frame.ClockOffset, end + frame.ClockOffset, scope.FlowID);
+                }
+            }
+        }
+
+        frame.Scopes.clear();
+        frame.NextQuery = TE_NULL;
+    }
+
+    GLuint GL_GPUProfiler::AcquireQuery(GL_GPUFrameQueries& frame)
+    {
+        if(frame.NextQuery == frame.Queries.size())
+        {
+            frame.Queries.resize(frame.Queries.size() + GPU_PROFILER_QUERY_CHUNK);
+            glGenQueries(GPU_PROFILER_QUERY_CHUNK, frame.Queries.data() + frame.NextQuery);
+        }
+
+        return frame.Queries[frame.NextQuery++];
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+#include <glad/glad.h>
+
+#include "TypeDef.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    static const UInt32 GPU_PROFILER_FRAME_LATENCY  = 3;
+    static const UInt32 GPU_PROFILER_QUERY_CHUNK    = 64;
+    static const UInt32 GPU_PROFILER_MAX_QUERIES    = GPU_PROFILER_QUERY_CHUNK * 16;   // per frame slot
+
+    struct GL_GPUScopeRecord
+    {
+        CString Name{ nullptr };
+        UInt32 BeginQuery{ TE_NULL };
+        UInt32 EndQuery{ TE_NULL };
+        UInt64 FlowID{ TE_NULL };
+    };
+
+    // Queries issued in a frame are only read back GPU_PROFILER_FRAME_LATENCY frames later, when the
+    // GPU has long since passed them, so resolving never waits on the driver.
+    struct GL_GPUFrameQueries
+    {
+        std::vector<GLuint> Queries;
+        std::vector<GL_GPUScopeRecord> Scopes;
+        UInt32 NextQuery{ TE_NULL };
+        Int64 ClockOffset{ TE_NULL };   // steady clock minus GL_TIMESTAMP when the frame began
+    };
+
+    class GL_GPUProfiler
+    {
+        private:
+            GL_GPUProfiler() = default;
+            ~GL_GPUProfiler() = default;
+
+        public:
+            static void Init();
+            static void Shutdown();
+
+            static void BeginFrame();
+            static UInt32 BeginScope(CString name);
+            static void EndScope(UInt32 scope);
+            static UInt64 GetDroppedFrames();
+            static UInt64 GetDroppedScopes();
+
+        private:
+            static void Resolve(GL_GPUFrameQueries& frame);
+            static GLuint AcquireQuery(GL_GPUFrameQueries& frame);
+    };
+}
@@ -0,0 +1,200 @@
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+#include "GL_ProgramCache.hpp"
+#include "GL_SystemInfo.hpp"
+#include "Asserts.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    static const UInt32 PROGRAM_CACHE_MAGIC     = 0x42505445;
+    static const UInt32 PROGRAM_CACHE_VERSION   = 1;
+    static const UInt64 FNV_OFFSET_BASIS        = 14695981039346656037ull;
+    static const UInt64 FNV_PRIME               = 1099511628211ull;
+
+    struct ProgramCacheHeader
+    {
+        UInt32 Magic{PROGRAM_CACHE_MAGIC};
+        UInt32 Version{PROGRAM_CACHE_VERSION};
+        UInt64 Key{TE_NULL};
+        UInt32 Format{TE_NULL};
+        UInt32 Size{TE_NULL};
+    };
+
+    struct ProgramCacheData
+    {
+        Boolean Enabled{TE_FALSE};
+        Path Directory{};
+        UInt64 DriverHash{FNV_OFFSET_BASIS};
+        GL_ProgramCacheStats Stats{};
+    };
+
+    static ProgramCacheData s_CacheData;
+
+    static UInt64 HashBytes(UInt64 hash, const void* data, UInt64 size)
+    {
+        const UInt8* bytes = static_cast<const UInt8*>(data);
+        for(UInt64 i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    static UInt64 HashString(UInt64 hash, const String& value)
+    {
+        return HashBytes(hash, value.data(), value.size() + 1);
+    }
+
+    static Path EntryPath(UInt64 key)
+    {
+        std::stringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+        return s_CacheData.Directory / ss.str();
+    }
+
+    void GL_ProgramCache::Init(const Path& directory)
+    {
+        s_CacheData = ProgramCacheData{};
+
+        GLint format_count = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+        if(format_count <= 0)
+        {
+            TE_CORE_WARN("Driver exposes no program binary formats, shader cache disabled");
+            return;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if(error)
+        {
+            TE_CORE_WARN("Failed to create shader cache directory '{0}': {1}", directory.string(), error.message());
+            return;
+        }
+
+        UInt64 hash = FNV_OFFSET_BASIS;
+        hash = HashString(hash, GL_SystemInfo::GetVendor());
+        hash = HashString(hash, GL_SystemInfo::GetRenderer());
+        hash = HashString(hash, GL_SystemInfo::GetVersion());
+
+        s_CacheData.Enabled = TE_TRUE;
+        s_CacheData.Directory = directory;
+        s_CacheData.DriverHash = hash;
+    }
+
+    void GL_ProgramCache::Shutdown()
+    {
+        if(s_CacheData.Enabled)
+            TE_CORE_INFO("Shader cache: {0} hits, {1} misses", s_CacheData.Stats.Hits, s_CacheData.Stats.Misses);
+
+        s_CacheData.Enabled = TE_FALSE;
+    }
+
+    Boolean GL_ProgramCache::IsEnabled()
+    {
+        return s_CacheData.Enabled;
+    }
+
+    UInt64 GL_ProgramCache::ComputeKey(const std::unordered_map<GLenum, String>& sources)
+    {
+        std::vector<GLenum> stages;
+        stages.reserve(sources.size());
+        for(auto& source : sources)
+            stages.emplace_back(source.first);
+
+        std::sort(stages.begin(), stages.end());
+
+        UInt64 hash = s_CacheData.DriverHash;
+        for(GLenum stage : stages)
+        {
+            hash = HashBytes(hash, &stage, sizeof(stage));
+            hash = HashString(hash, sources.at(stage));
+        }
+
+        return hash;
+    }
+
+    Boolean GL_ProgramCache::Load(GLuint program, UInt64 key)
+    {
+        if(!s_CacheData.Enabled)
+            return TE_FALSE;
+
+        InputFile in_file(EntryPath(key), std::ios::in | std::ios::binary);
+        ProgramCacheHeader header{};
+        if(!in_file || !in_file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.Magic != PROGRAM_CACHE_MAGIC || header.Version != PROGRAM_CACHE_VERSION || header.Key != key)
+        {
+            s_CacheData.Stats.Misses++;
+            return TE_FALSE;
+        }
+
+        std::vector<char> binary(header.Size);
+        if(!in_file.read(binary.data(), binary.size()))
+        {
+            s_CacheData.Stats.Misses++;
+            return TE_FALSE;
+        }
+
+        glProgramBinary(program, header.Format, binary.data(), header.Size);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if(linked != GL_TRUE)
+        {
+            // Drivers reject binaries after an update that kept the version string; drop the stale entry.
+            in_file.close();
+            std::error_code error;
+            std::filesystem::remove(EntryPath(key), error);
+            s_CacheData.Stats.Misses++;
+            return TE_FALSE;
+        }
+
+        s_CacheData.Stats.Hits++;
+        return TE_TRUE;
+    }
+
+    void GL_ProgramCache::Store(GLuint program, UInt64 key)
+    {
+        if(!s_CacheData.Enabled)
+            return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if(length <= 0)
+            return;
+
+        ProgramCacheHeader header{};
+        header.Key = key;
+        std::vector<char> binary(length);
+        GLsizei written = 0;
+        glGetProgramBinary(program, length, &written, &header.Format, binary.data());
+        header.Size = static_cast<UInt32>(written);
+
+        Path path = EntryPath(key);
+        Path temp = path;
+        temp += ".tmp";
+        {
+            std::ofstream out_file(temp, std::ios::out | std::ios::binary | std::ios::trunc);
+            if(!out_file)
+            {
+                TE_CORE_WARN("Failed to write shader cache entry '{0}'", temp.string());
+                return;
+            }
+
+            out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out_file.write(binary.data(), header.Size);
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temp, path, error);
+    }
+
+    const GL_ProgramCacheStats& GL_ProgramCache::GetStats()
+    {
+        return s_CacheData.Stats;
+    }
+}
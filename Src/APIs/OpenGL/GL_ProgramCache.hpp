@@ -0,0 +1,34 @@
+#pragma once
+
+#include <unordered_map>
+#include <glad/glad.h>
+
+#include "TypeDef.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    struct GL_ProgramCacheStats
+    {
+        UInt64 Hits{TE_NULL};
+        UInt64 Misses{TE_NULL};
+    };
+
+    // On-disk store of linked program binaries keyed by the shader sources and the driver that built them.
+    class GL_ProgramCache
+    {
+        private:
+            GL_ProgramCache() = default;
+            ~GL_ProgramCache() = default;
+
+        public:
+            static void Init(const Path& directory = "Cache/Shaders");
+            static void Shutdown();
+            static Boolean IsEnabled();
+
+            static UInt64 ComputeKey(const std::unordered_map<GLenum, String>& sources);
+            static Boolean Load(GLuint program, UInt64 key);
+            static void Store(GLuint program, UInt64 key);
+
+            static const GL_ProgramCacheStats& GetStats();
+    };
+}
@@ -1,12 +1,19 @@
 #include "GL_Renderer.hpp"
+#include "GL_Shader.hpp"
+#include "GL_Texture2D.hpp"
+#include "GPUProfiler.hpp"
 
 namespace TE::APIs::OpenGL
 {
     void GL_Renderer::Init()
     {
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glEnable(GL_DEPTH_TEST);
+        GL_StateCache::Invalidate();
+        GL_StateCache::SetCapability(GL_BLEND, TE_TRUE);
+        GL_StateCache::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        GL_StateCache::SetCapability(GL_DEPTH_TEST, TE_TRUE);
+        GL_ProgramCache::Init();
+        GL_Shader::EnableParallelCompile();
+        GL_GPUProfiler::Init();
 
         #ifdef TRIMANA_DEBUG
 
@@ -20,10 +27,13 @@ namespace TE::APIs::OpenGL
 
     void GL_Renderer::Shutdown()
     {
+        GL_GPUProfiler::Shutdown();
+        GL_ProgramCache::Shutdown();
     }
 
     void GL_Renderer::Clear()
     {
+        TE_GPU_PROFILE_SCOPE("GL_Renderer::Clear");
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
@@ -34,7 +44,7 @@ namespace TE::APIs::OpenGL
 
     void GL_Renderer::SetViewport(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
     {
-        glViewport(x, y, width, height);
+        GL_StateCache::Viewport(x, y, width, height);
     }
 
 
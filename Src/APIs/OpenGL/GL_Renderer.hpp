@@ -5,6 +5,9 @@
 
 #include "TypeDef.hpp"
 #include "GL_Debug.hpp"
+#include "GL_StateCache.hpp"
+#include "GL_ProgramCache.hpp"
+#include "GL_GPUProfiler.hpp"
 
 namespace TE::APIs::OpenGL
 {
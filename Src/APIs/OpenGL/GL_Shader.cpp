@@ -1,9 +1,16 @@
+#include <algorithm>
+
 #include "GL_Shader.hpp"
+#include "GL_StateCache.hpp"
+#include "GL_ProgramCache.hpp"
 #include "Asserts.hpp"
 
 namespace TE::APIs::OpenGL
 {
+    static Boolean s_ParallelCompile = TE_FALSE;
+
     GL_Shader::GL_Shader(const String& name, const Path& vtxShader, const Path& fragShader)
+        : m_VertexPath(vtxShader), m_FragmentPath(fragShader)
     {
         std::unordered_map<GLenum, String> shaderSources
         {
@@ -11,23 +18,125 @@ namespace TE::APIs::OpenGL
             {GL_FRAGMENT_SHADER, ReadShaderFiles(fragShader)}
         };
 
+        m_Name = name;
         CompileShaders(shaderSources);
+    }
+
+    GL_Shader::GL_Shader(const String& name, std::string_view vtxSource, std::string_view fragSource)
+    {
+        std::unordered_map<GLenum, String> shaderSources
+        {
+            {GL_VERTEX_SHADER, String(vtxSource)},
+            {GL_FRAGMENT_SHADER, String(fragSource)}
+        };
+
         m_Name = name;
+        CompileShaders(shaderSources);
+    }
+
+    GL_Shader::GL_Shader(const String& name, std::unordered_map<GLenum, String>& sources)
+    {
+        m_Name = name;
+        CompileShaders(sources);
     }
 
     GL_Shader::~GL_Shader()
     {
+        for(UInt32 shader : m_PendingShaders)
+            glDeleteShader(shader);
+
+        GL_StateCache::ForgetProgram(m_programID);
         glDeleteProgram(m_programID);
     }
 
+    void GL_Shader::EnableParallelCompile()
+    {
+        s_ParallelCompile = GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+        if(GLAD_GL_KHR_parallel_shader_compile)
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        else if(GLAD_GL_ARB_parallel_shader_compile)
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+
+    Boolean GL_Shader::IsReady() const
+    {
+        if(m_Ready)
+            return TE_TRUE;
+
+        GLint completed = GL_FALSE;
+        glGetProgramiv(m_programID, GL_COMPLETION_STATUS_KHR, &completed);
+        if(completed != GL_TRUE)
+            return TE_FALSE;
+
+        Finalize();
+        return TE_TRUE;
+    }
+
+    Boolean GL_Shader::IsValid() const
+    {
+        if(!m_Ready)
+            Finalize();
+
+        return m_Linked;
+    }
+
+    void GL_Shader::Reload(const String& vtxSource, const String& fragSource)
+    {
+        std::unordered_map<GLenum, String> shaderSources
+        {
+            {GL_VERTEX_SHADER, vtxSource},
+            {GL_FRAGMENT_SHADER, fragSource}
+        };
+
+        m_Reloaded = CreateScope<GL_Shader>(m_Name, shaderSources);
+    }
+
+    // Called at a frame boundary. The old program stays in use until the replacement has linked, and a
+    // replacement that fails to build is dropped so the last good program keeps rendering. A program
+    // still in its first parallel compile is not swapped until it has finished.
+    Boolean GL_Shader::ApplyReload()
+    {
+        if(!m_Reloaded)
+            return TE_TRUE;
+
+        if(!IsReady() || !m_Reloaded->IsReady())
+            return TE_FALSE;
+
+        if(m_Reloaded->IsValid())
+        {
+            std::swap(m_programID, m_Reloaded->m_programID);
+            std::swap(m_CacheKey, m_Reloaded->m_CacheKey);
+            std::swap(m_Uniforms, m_Reloaded->m_Uniforms);
+            m_Linked = TE_TRUE;
+            m_Ready = TE_TRUE;
+            TE_CORE_INFO("Reloaded shader '{0}'", m_Name);
+        }
+
+        m_Reloaded.reset();
+        return TE_TRUE;
+    }
+
+    const Path& GL_Shader::GetVertexPath() const
+    {
+        return m_VertexPath;
+    }
+
+    const Path& GL_Shader::GetFragmentPath() const
+    {
+        return m_FragmentPath;
+    }
+
     void GL_Shader::Bind() const
     {
-        glUseProgram(m_programID);
+        if(!m_Ready)
+            Finalize();
+
+        GL_StateCache::UseProgram(m_programID);
     }
 
     void GL_Shader::Unbind() const
     {
-        glUseProgram(0);
+        GL_StateCache::UseProgram(0);
     }
 
     ShaderProgramID GL_Shader::GetID() const
@@ -40,65 +149,62 @@ namespace TE::APIs::OpenGL
         return m_Name;
     }
 
-    UniformLocation GL_Shader::GetUniformLocation(const String& uniformName)
+    UniformLocation GL_Shader::GetUniformLocation(TE::Renderer::UniformID uniform) const
     {
-        if(m_UniformLocations.find(uniformName) != m_UniformLocations.end())
-            return m_UniformLocations[uniformName];
+        if(!m_Ready)
+            Finalize();
 
-        UniformLocation location = glGetUniformLocation(m_programID, uniformName.c_str());
-        if(location >= 0)
-        {
-            m_UniformLocations[uniformName] = location;
-            return location;
-        }
+        auto it = std::lower_bound(m_Uniforms.begin(), m_Uniforms.end(), uniform.GetHash(), [](const UniformEntry& entry, UInt32 hash) { return entry.Hash < hash; });
+        if(it != m_Uniforms.end() && it->Hash == uniform.GetHash())
+            return it->Location;
 
-        TE_CORE_WARN("Uniform '{0}' not found in shader '{1}'", uniformName, m_Name);
+        TE_CORE_WARN("Uniform {0:#x} not found in shader '{1}'", uniform.GetHash(), m_Name);
         return -1;
     }
 
-    void GL_Shader::SetUnifrom(const String& uniformName, Float value)
+    void GL_Shader::SetUnifrom(TE::Renderer::UniformID uniform, Float value)
     {
-        glUniform1f(GetUniformLocation(uniformName), value);
+        glUniform1f(GetUniformLocation(uniform), value);
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, Int32 value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, Int32 value)
     {
-        glUniform1i(GetUniformLocation(uniformName), value);
+        glUniform1i(GetUniformLocation(uniform), value);
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, UInt32 value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, UInt32 value)
     {
-        glUniform1i(GetUniformLocation(uniformName), value);
+        glUniform1i(GetUniformLocation(uniform), value);
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, const Vec2& value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, const Vec2& value)
     {
-        glUniform2fv(GetUniformLocation(uniformName), 1, glm::value_ptr(value));
+        glUniform2fv(GetUniformLocation(uniform), 1, glm::value_ptr(value));
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, const Vec3& value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, const Vec3& value)
     {
-        glUniform3fv(GetUniformLocation(uniformName), 1, glm::value_ptr(value));
+        glUniform3fv(GetUniformLocation(uniform), 1, glm::value_ptr(value));
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, const Vec4& value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, const Vec4& value)
     {
-        glUniform4fv(GetUniformLocation(uniformName), 1, glm::value_ptr(value));
+        glUniform4fv(GetUniformLocation(uniform), 1, glm::value_ptr(value));
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, const Mat2& value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, const Mat2& value)
     {
-        glUniformMatrix2fv(GetUniformLocation(uniformName), 1, GL_FALSE, glm::value_ptr(value));
+        glUniformMatrix2fv(GetUniformLocation(uniform), 1, GL_FALSE, glm::value_ptr(value));
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, const Mat3& value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, const Mat3& value)
     {
-        glUniformMatrix3fv(GetUniformLocation(uniformName), 1, GL_FALSE, glm::value_ptr(value));
+        glUniformMatrix3fv(GetUniformLocation(uniform), 1, GL_FALSE, glm::value_ptr(value));
     }
 
-    void GL_Shader::SetUniform(const String& uniformName, const Mat4& value)
+    void GL_Shader::SetUniform(TE::Renderer::UniformID uniform, const Mat4& value)
     {
-        glUniformMatrix4fv(GetUniformLocation(uniformName), 1, GL_FALSE, glm::value_ptr(value));
+        glUniformMatrix4fv(GetUniformLocation(uniform), 1, GL_FALSE, glm::value_ptr(value));
     }
 
     void GL_Shader::CompileShaders(std::unordered_map<GLenum, String>& shaders)
@@ -110,6 +216,16 @@ namespace TE::APIs::OpenGL
             return;
         }
 
+        m_programID = programID;
+        m_CacheKey = GL_ProgramCache::ComputeKey(shaders);
+        if(GL_ProgramCache::Load(programID, m_CacheKey))
+        {
+            m_Linked = TE_TRUE;
+            m_Ready = TE_TRUE;
+            ReflectUniforms();
+            return;
+        }
+
         for (auto& source : shaders) 
         {
             GLenum type = source.first;
@@ -119,11 +235,114 @@ namespace TE::APIs::OpenGL
             glShaderSource(shader, 1, &src_cstr, nullptr);
             glCompileShader(shader);
             glAttachShader(programID, shader);
+            m_PendingShaders.emplace_back(shader);
         }
 
+        if(GL_ProgramCache::IsEnabled())
+            glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
         glLinkProgram(programID);
-        glValidateProgram(programID);
-        m_programID = programID;
+
+        // With parallel compilation the driver keeps working in the background; status queries are
+        // deferred to the first IsReady() that sees completion, or to first use.
+        if(!s_ParallelCompile)
+            Finalize();
+    }
+
+    void GL_Shader::Finalize() const
+    {
+        GLchar info_log[1024];
+        for(UInt32 shader : m_PendingShaders)
+        {
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if(compiled != GL_TRUE)
+            {
+                glGetShaderInfoLog(shader, sizeof(info_log), nullptr, info_log);
+                TE_CORE_ERROR("Shader '{0}' failed to compile: {1}", m_Name, info_log);
+            }
+
+            glDetachShader(m_programID, shader);
+            glDeleteShader(shader);
+        }
+
+        m_PendingShaders.clear();
+        m_Ready = TE_TRUE;
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(m_programID, GL_LINK_STATUS, &linked);
+        if(linked != GL_TRUE)
+        {
+            glGetProgramInfoLog(m_programID, sizeof(info_log), nullptr, info_log);
+            TE_CORE_ERROR("Shader '{0}' failed to link: {1}", m_Name, info_log);
+            return;
+        }
+
+        m_Linked = TE_TRUE;
+        GL_ProgramCache::Store(m_programID, m_CacheKey);
+        ReflectUniforms();
+    }
+
+    static Boolean IsSamplerType(GLenum type)
+    {
+        switch(type)
+        {
+            case GL_SAMPLER_1D:
+            case GL_SAMPLER_2D:
+            case GL_SAMPLER_3D:
+            case GL_SAMPLER_CUBE:
+            case GL_SAMPLER_2D_ARRAY:
+            case GL_SAMPLER_2D_SHADOW:
+            case GL_SAMPLER_2D_MULTISAMPLE:
+            case GL_INT_SAMPLER_2D:
+            case GL_UNSIGNED_INT_SAMPLER_2D:
+                return TE_TRUE;
+            default:
+                return TE_FALSE;
+        }
+    }
+
+    // Builds the hash-sorted location table from the program interface. Sampler uniforms never change
+    // after linking, so each one also gets consecutive texture units here in declaration order.
+    void GL_Shader::ReflectUniforms() const
+    {
+        m_Uniforms.clear();
+
+        GLint uniform_count = 0;
+        glGetProgramInterfaceiv(m_programID, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniform_count);
+
+        const GLenum properties[] = { GL_BLOCK_INDEX, GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE };
+        GLchar name[256];
+        Int32 next_unit = 0;
+        std::vector<GLint> units;
+        for(GLint i = 0; i < uniform_count; i++)
+        {
+            GLint values[4] = { -1, -1, GL_NONE, 0 };
+            glGetProgramResourceiv(m_programID, GL_UNIFORM, i, 4, properties, 4, nullptr, values);
+            if(values[0] != -1 || values[1] < 0)
+                continue;
+
+            GLsizei length = 0;
+            glGetProgramResourceName(m_programID, GL_UNIFORM, i, sizeof(name), &length, name);
+            std::string_view uniform_name(name, length);
+            if(uniform_name.ends_with("[0]"))
+                uniform_name.remove_suffix(3);
+
+            m_Uniforms.push_back({ TE::Renderer::UniformID::Hash(uniform_name), values[1] });
+
+            if(IsSamplerType(static_cast<GLenum>(values[2])))
+            {
+                units.resize(values[3]);
+                for(GLint unit = 0; unit < values[3]; unit++)
+                    units[unit] = next_unit++;
+
+                glProgramUniform1iv(m_programID, values[1], values[3], units.data());
+            }
+        }
+
+        std::sort(m_Uniforms.begin(), m_Uniforms.end(), [](const UniformEntry& a, const UniformEntry& b) { return a.Hash < b.Hash; });
+        for(UInt32 i = 1; i < m_Uniforms.size(); i++)
+            TRIMANA_ASSERT(m_Uniforms[i - 1].Hash != m_Uniforms[i].Hash, "Uniform name hash collision");
     }
 
     String GL_Shader::ReadShaderFiles(const Path& filePath)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include <glad/glad.h>
 
 #include "TypeDef.hpp"
@@ -7,35 +8,60 @@
 
 namespace TE::APIs::OpenGL
 {
+    struct UniformEntry
+    {
+        UInt32 Hash{TE_NULL};
+        GLint Location{-1};
+    };
+
     class GL_Shader : public TE::Renderer::Shader
     {
         public:
             GL_Shader() = default;
             GL_Shader(const String& name, const Path& vtxShader, const Path& fragShader);
+            GL_Shader(const String& name, std::string_view vtxSource, std::string_view fragSource);
+            GL_Shader(const String& name, std::unordered_map<GLenum, String>& sources);
             virtual ~GL_Shader();
 
+            static void EnableParallelCompile();
+
+            virtual Boolean IsReady() const override;
+            virtual Boolean IsValid() const override;
+            virtual void Reload(const String& vtxSource, const String& fragSource) override;
+            virtual Boolean ApplyReload() override;
+            virtual const Path& GetVertexPath() const override;
+            virtual const Path& GetFragmentPath() const override;
             virtual void Bind() const override;
             virtual void Unbind() const override;
             virtual ShaderProgramID GetID() const override;
             virtual const String& GetName() const override;
-            virtual UniformLocation GetUniformLocation(const String& uniformName) override;
-            virtual void SetUnifrom(const String& uniformName, Float value) override;
-            virtual void SetUniform(const String& uniformName, Int32 value) override;
-            virtual void SetUniform(const String& uniformName, UInt32 value) override;
-            virtual void SetUniform(const String& uniformName, const Vec2& value) override;
-            virtual void SetUniform(const String& uniformName, const Vec3& value) override;
-            virtual void SetUniform(const String& uniformName, const Vec4& value) override;
-            virtual void SetUniform(const String& uniformName, const Mat2& value) override;
-            virtual void SetUniform(const String& uniformName, const Mat3& value) override;
-            virtual void SetUniform(const String& uniformName, const Mat4& value) override;
+            virtual UniformLocation GetUniformLocation(TE::Renderer::UniformID uniform) const override;
+            virtual void SetUnifrom(TE::Renderer::UniformID uniform, Float value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, Int32 value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, UInt32 value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, const Vec2& value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, const Vec3& value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, const Vec4& value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, const Mat2& value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, const Mat3& value) override;
+            virtual void SetUniform(TE::Renderer::UniformID uniform, const Mat4& value) override;
 
         private:
             void CompileShaders(std::unordered_map<GLenum, String>& shaders);
+            void Finalize() const;
+            void ReflectUniforms() const;
             String ReadShaderFiles(const Path& filePath);
 
         private:
             ShaderProgramID m_programID{TE_NULL};
             String m_Name{String()};
-            std::unordered_map<String, UniformLocation> m_UniformLocations;
+            Path m_VertexPath{};
+            Path m_FragmentPath{};
+            Scope<GL_Shader> m_Reloaded{nullptr};
+            UInt64 m_CacheKey{TE_NULL};
+            mutable Boolean m_Ready{TE_FALSE};
+            mutable Boolean m_Linked{TE_FALSE};
+            mutable std::vector<UInt32> m_PendingShaders;
+            mutable std::vector<UniformEntry> m_Uniforms;
     };
 }
\ No newline at end of file
@@ -0,0 +1,343 @@
+#include <array>
+
+#include "GL_StateCache.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    static const GLuint UNKNOWN_BINDING             = 0xFFFFFFFF;
+    static const UInt32 MAX_CACHED_TEXTURE_UNITS    = 64;
+    static const UInt32 MAX_CACHED_BUFFER_INDICES   = 16;
+
+    enum class BufferTarget
+    {
+        Array               = 0,
+        ElementArray        = 1,
+        DrawIndirect        = 2,
+        ShaderStorage       = 3,
+        Uniform             = 4,
+        PixelUnpack         = 5,
+        Count               = 6
+    };
+
+    enum class CapabilityState : UInt8
+    {
+        Unknown     = 0,
+        Disabled    = 1,
+        Enabled     = 2
+    };
+
+    struct IndexedBufferBinding
+    {
+        GLuint Buffer{ UNKNOWN_BINDING };
+        GLintptr Offset{ TE_NULL };
+        GLsizeiptr Size{ TE_NULL };
+    };
+
+    struct StateCacheData
+    {
+        GLuint Program{ UNKNOWN_BINDING };
+        GLuint VertexArray{ UNKNOWN_BINDING };
+        GLuint FrameBuffer{ UNKNOWN_BINDING };
+        GLuint ActiveTextureUnit{ UNKNOWN_BINDING };
+        std::array<GLuint, static_cast<UInt32>(BufferTarget::Count)> Buffers;
+        std::array<IndexedBufferBinding, MAX_CACHED_BUFFER_INDICES> StorageBuffers;
+        std::array<IndexedBufferBinding, MAX_CACHED_BUFFER_INDICES> UniformBuffers;
+        std::array<GLuint, MAX_CACHED_TEXTURE_UNITS> TextureUnits;
+        Int32 Viewport[4]{ -1, -1, -1, -1 };
+        CapabilityState Blend{ CapabilityState::Unknown };
+        CapabilityState DepthTest{ CapabilityState::Unknown };
+        CapabilityState CullFace{ CapabilityState::Unknown };
+        CapabilityState ScissorTest{ CapabilityState::Unknown };
+        GLenum BlendSource{ GL_NONE };
+        GLenum BlendDestination{ GL_NONE };
+        GLenum DepthFunction{ GL_NONE };
+        CapabilityState DepthWrite{ CapabilityState::Unknown };
+
+        GL_StateStats Stats;
+
+    }; static StateCacheData s_State;
+
+    static Boolean Track(GL_StateType type, Boolean redundant)
+    {
+        UInt32 index = static_cast<UInt32>(type);
+        redundant ? s_State.Stats.Redundant[index]++ : s_State.Stats.Issued[index]++;
+        return redundant;
+    }
+
+    static Int32 GetBufferTargetIndex(GLenum target)
+    {
+        switch(target)
+        {
+            case GL_ARRAY_BUFFER:               return static_cast<Int32>(BufferTarget::Array);
+            case GL_ELEMENT_ARRAY_BUFFER:       return static_cast<Int32>(BufferTarget::ElementArray);
+            case GL_DRAW_INDIRECT_BUFFER:       return static_cast<Int32>(BufferTarget::DrawIndirect);
+            case GL_SHADER_STORAGE_BUFFER:      return static_cast<Int32>(BufferTarget::ShaderStorage);
+            case GL_UNIFORM_BUFFER:             return static_cast<Int32>(BufferTarget::Uniform);
+            case GL_PIXEL_UNPACK_BUFFER:        return static_cast<Int32>(BufferTarget::PixelUnpack);
+            default:                            return -1;
+        }
+    }
+
+    static IndexedBufferBinding* GetIndexedBinding(GLenum target, UInt32 index)
+    {
+        if(index >= MAX_CACHED_BUFFER_INDICES)
+            return nullptr;
+
+        switch(target)
+        {
+            case GL_SHADER_STORAGE_BUFFER:      return &s_State.StorageBuffers[index];
+            case GL_UNIFORM_BUFFER:             return &s_State.UniformBuffers[index];
+            default:                            return nullptr;
+        }
+    }
+
+    static CapabilityState* GetCapability(GLenum capability)
+    {
+        switch(capability)
+        {
+            case GL_BLEND:                      return &s_State.Blend;
+            case GL_DEPTH_TEST:                 return &s_State.DepthTest;
+            case GL_CULL_FACE:                  return &s_State.CullFace;
+            case GL_SCISSOR_TEST:               return &s_State.ScissorTest;
+            default:                            return nullptr;
+        }
+    }
+
+    void GL_StateCache::Invalidate()
+    {
+        GL_StateStats stats = s_State.Stats;
+        s_State = StateCacheData();
+        s_State.Buffers.fill(UNKNOWN_BINDING);
+        s_State.TextureUnits.fill(UNKNOWN_BINDING);
+        s_State.Stats = stats;
+    }
+
+    void GL_StateCache::UseProgram(GLuint program)
+    {
+        if(Track(GL_StateType::Program, s_State.Program == program))
+            return;
+
+        s_State.Program = program;
+        glUseProgram(program);
+    }
+
+    // The element array binding is VAO state, so it is unknown after every VAO switch.
+    void GL_StateCache::BindVertexArray(GLuint vertexArray)
+    {
+        if(Track(GL_StateType::VertexArray, s_State.VertexArray == vertexArray))
+            return;
+
+        s_State.VertexArray = vertexArray;
+        s_State.Buffers[static_cast<UInt32>(BufferTarget::ElementArray)] = UNKNOWN_BINDING;
+        glBindVertexArray(vertexArray);
+    }
+
+    void GL_StateCache::BindBuffer(GLenum target, GLuint buffer)
+    {
+        Int32 index = GetBufferTargetIndex(target);
+        if(index >= 0 && Track(GL_StateType::Buffer, s_State.Buffers[index] == buffer))
+            return;
+
+        if(index >= 0)
+            s_State.Buffers[index] = buffer;
+        else
+            Track(GL_StateType::Buffer, TE_FALSE);
+
+        glBindBuffer(target, buffer);
+    }
+
+    // Indexed binds also replace the generic binding point of the target.
+    void GL_StateCache::BindBufferBase(GLenum target, UInt32 index, GLuint buffer)
+    {
+        IndexedBufferBinding* binding = GetIndexedBinding(target, index);
+        if(binding && Track(GL_StateType::Buffer, binding->Buffer == buffer && binding->Size == 0))
+            return;
+
+        if(binding)
+            *binding = { buffer, 0, 0 };
+        else
+            Track(GL_StateType::Buffer, TE_FALSE);
+
+        Int32 generic = GetBufferTargetIndex(target);
+        if(generic >= 0)
+            s_State.Buffers[generic] = buffer;
+
+        glBindBufferBase(target, index, buffer);
+    }
+
+    void GL_StateCache::BindBufferRange(GLenum target, UInt32 index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        IndexedBufferBinding* binding = GetIndexedBinding(target, index);
+        if(binding && Track(GL_StateType::Buffer, binding->Buffer == buffer && binding->Offset == offset && binding->Size == size))
+            return;
+
+        if(binding)
+            *binding = { buffer, offset, size };
+        else
+            Track(GL_StateType::Buffer, TE_FALSE);
+
+        Int32 generic = GetBufferTargetIndex(target);
+        if(generic >= 0)
+            s_State.Buffers[generic] = buffer;
+
+        glBindBufferRange(target, index, buffer, offset, size);
+    }
+
+    void GL_StateCache::ActiveTexture(UInt32 unit)
+    {
+        if(Track(GL_StateType::Texture, s_State.ActiveTextureUnit == unit))
+            return;
+
+        s_State.ActiveTextureUnit = unit;
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+
+    // Target binds land on the active unit; when that is unknown unit 0 is selected first. The unit
+    // only records one texture, so a target bind leaves it unknown rather than guessing which target
+    // glBindTextureUnit would replace.
+    void GL_StateCache::BindTexture(GLenum target, GLuint texture)
+    {
+        if(s_State.ActiveTextureUnit == UNKNOWN_BINDING)
+            ActiveTexture(0);
+
+        Track(GL_StateType::Texture, TE_FALSE);
+        if(s_State.ActiveTextureUnit < MAX_CACHED_TEXTURE_UNITS)
+            s_State.TextureUnits[s_State.ActiveTextureUnit] = UNKNOWN_BINDING;
+
+        glBindTexture(target, texture);
+    }
+
+    void GL_StateCache::BindTextureUnit(UInt32 unit, GLuint texture)
+    {
+        if(unit < MAX_CACHED_TEXTURE_UNITS && Track(GL_StateType::Texture, s_State.TextureUnits[unit] == texture))
+            return;
+
+        if(unit < MAX_CACHED_TEXTURE_UNITS)
+            s_State.TextureUnits[unit] = texture;
+        else
+            Track(GL_StateType::Texture, TE_FALSE);
+
+        glBindTextureUnit(unit, texture);
+    }
+
+    void GL_StateCache::BindFrameBuffer(GLuint frameBuffer)
+    {
+        if(Track(GL_StateType::FrameBuffer, s_State.FrameBuffer == frameBuffer))
+            return;
+
+        s_State.FrameBuffer = frameBuffer;
+        glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer);
+    }
+
+    void GL_StateCache::Viewport(Int32 x, Int32 y, Int32 width, Int32 height)
+    {
+        Int32* viewport = s_State.Viewport;
+        if(Track(GL_StateType::Viewport, viewport[0] == x && viewport[1] == y && viewport[2] == width && viewport[3] == height))
+            return;
+
+        viewport[0] = x; viewport[1] = y; viewport[2] = width; viewport[3] = height;
+        glViewport(x, y, width, height);
+    }
+
+    void GL_StateCache::SetCapability(GLenum capability, Boolean enable)
+    {
+        CapabilityState requested = enable ? CapabilityState::Enabled : CapabilityState::Disabled;
+        CapabilityState* state = GetCapability(capability);
+        if(state && Track(GL_StateType::Capability, *state == requested))
+            return;
+
+        if(state)
+            *state = requested;
+        else
+            Track(GL_StateType::Capability, TE_FALSE);
+
+        enable ? glEnable(capability) : glDisable(capability);
+    }
+
+    void GL_StateCache::BlendFunc(GLenum source, GLenum destination)
+    {
+        if(Track(GL_StateType::Blend, s_State.BlendSource == source && s_State.BlendDestination == destination))
+            return;
+
+        s_State.BlendSource = source;
+        s_State.BlendDestination = destination;
+        glBlendFunc(source, destination);
+    }
+
+    void GL_StateCache::DepthFunc(GLenum function)
+    {
+        if(Track(GL_StateType::Depth, s_State.DepthFunction == function))
+            return;
+
+        s_State.DepthFunction = function;
+        glDepthFunc(function);
+    }
+
+    void GL_StateCache::DepthMask(Boolean write)
+    {
+        CapabilityState requested = write ? CapabilityState::Enabled : CapabilityState::Disabled;
+        if(Track(GL_StateType::Depth, s_State.DepthWrite == requested))
+            return;
+
+        s_State.DepthWrite = requested;
+        glDepthMask(write ? GL_TRUE : GL_FALSE);
+    }
+
+    void GL_StateCache::ForgetProgram(GLuint program)
+    {
+        if(s_State.Program == program)
+            s_State.Program = UNKNOWN_BINDING;
+    }
+
+    void GL_StateCache::ForgetVertexArray(GLuint vertexArray)
+    {
+        if(s_State.VertexArray == vertexArray)
+            s_State.VertexArray = UNKNOWN_BINDING;
+    }
+
+    void GL_StateCache::ForgetBuffer(GLuint buffer)
+    {
+        for(auto& binding : s_State.Buffers)
+        {
+            if(binding == buffer)
+                binding = UNKNOWN_BINDING;
+        }
+
+        for(auto& binding : s_State.StorageBuffers)
+        {
+            if(binding.Buffer == buffer)
+                binding = IndexedBufferBinding();
+        }
+
+        for(auto& binding : s_State.UniformBuffers)
+        {
+            if(binding.Buffer == buffer)
+                binding = IndexedBufferBinding();
+        }
+    }
+
+    void GL_StateCache::ForgetTexture(GLuint texture)
+    {
+        for(auto& unit : s_State.TextureUnits)
+        {
+            if(unit == texture)
+                unit = UNKNOWN_BINDING;
+        }
+    }
+
+    void GL_StateCache::ForgetFrameBuffer(GLuint frameBuffer)
+    {
+        if(s_State.FrameBuffer == frameBuffer)
+            s_State.FrameBuffer = UNKNOWN_BINDING;
+    }
+
+    const GL_StateStats& GL_StateCache::GetStats()
+    {
+        return s_State.Stats;
+    }
+
+    void GL_StateCache::ResetStats()
+    {
+        s_State.Stats = GL_StateStats();
+    }
+}
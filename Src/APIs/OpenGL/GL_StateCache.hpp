@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include "TypeDef.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    enum class GL_StateType
+    {
+        Program         = 0,
+        VertexArray     = 1,
+        Buffer          = 2,
+        Texture         = 3,
+        FrameBuffer     = 4,
+        Viewport        = 5,
+        Capability      = 6,
+        Blend           = 7,
+        Depth           = 8,
+        Count           = 9
+    };
+
+    struct GL_StateStats
+    {
+        UInt64 Issued[static_cast<UInt32>(GL_StateType::Count)]{};
+        UInt64 Redundant[static_cast<UInt32>(GL_StateType::Count)]{};
+    };
+
+    // Shadows the bound state of the single GL context and drops calls that would not change it. Code
+    // that touches GL behind the cache (the ImGui backend, for one) must call Invalidate() afterwards.
+    class GL_StateCache
+    {
+        private:
+            GL_StateCache() = default;
+            ~GL_StateCache() = default;
+
+        public:
+            static void Invalidate();
+
+            static void UseProgram(GLuint program);
+            static void BindVertexArray(GLuint vertexArray);
+            static void BindBuffer(GLenum target, GLuint buffer);
+            static void BindBufferBase(GLenum target, UInt32 index, GLuint buffer);
+            static void BindBufferRange(GLenum target, UInt32 index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+            static void ActiveTexture(UInt32 unit);
+            static void BindTexture(GLenum target, GLuint texture);
+            static void BindTextureUnit(UInt32 unit, GLuint texture);
+            static void BindFrameBuffer(GLuint frameBuffer);
+            static void Viewport(Int32 x, Int32 y, Int32 width, Int32 height);
+            static void SetCapability(GLenum capability, Boolean enable);
+            static void BlendFunc(GLenum source, GLenum destination);
+            static void DepthFunc(GLenum function);
+            static void DepthMask(Boolean write);
+
+            static void ForgetProgram(GLuint program);
+            static void ForgetVertexArray(GLuint vertexArray);
+            static void ForgetBuffer(GLuint buffer);
+            static void ForgetTexture(GLuint texture);
+            static void ForgetFrameBuffer(GLuint frameBuffer);
+
+            static const GL_StateStats& GetStats();
+            static void ResetStats();
+    };
+}
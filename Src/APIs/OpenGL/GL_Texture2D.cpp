@@ -1,35 +1,42 @@
 #include "GL_Texture2D.hpp"
+#include "GL_StateCache.hpp"
 #include "Asserts.hpp"
 
-#include <stb/stb_image.h>
+#include "TextureFile.hpp"
+
+#include <atomic>
+#include <vector>
+#include <algorithm>
 
 namespace TE::APIs::OpenGL
 {
-    GL_Texture2D::GL_Texture2D(UInt32 width, UInt32 height)
+    static std::atomic<UInt64> s_NextTextureSerial{ 1 };
+
+    static Boolean IsCompressed(TE::Renderer::TextureFormat format)
     {
-        m_Width = width;
-        m_Height = height;
-        m_Channels = GL_RGBA;
-
-        m_Data = new UInt8[m_Width * m_Height * m_Channels];
-        std::memset(m_Data, 255, m_Width * m_Height * m_Channels);
-        m_InternalFormat = GL_RGBA8;
-        m_DataFormat = GL_RGBA;
-
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_TextureID);
-        glBindTexture(GL_TEXTURE_2D, m_TextureID);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexImage2D(GL_TEXTURE_2D, 0, m_InternalFormat, m_Width, m_Height, 0, m_DataFormat, GL_UNSIGNED_BYTE, m_Data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        m_FromImageFile = false;
+        return format == TE::Renderer::TextureFormat::BC1 || format == TE::Renderer::TextureFormat::BC3 || format == TE::Renderer::TextureFormat::BC7;
+    }
 
+    static GLenum ToGLInternalFormat(TE::Renderer::TextureFormat format)
+    {
+        switch(format)
+        {
+            case TE::Renderer::TextureFormat::RGB8:     return GL_RGB8;
+            case TE::Renderer::TextureFormat::RGBA8:    return GL_RGBA8;
+            case TE::Renderer::TextureFormat::BC1:      return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+            case TE::Renderer::TextureFormat::BC3:      return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            case TE::Renderer::TextureFormat::BC7:      return GL_COMPRESSED_RGBA_BPTC_UNORM;
+            default:                                    return GL_NONE;
+        }
     }
 
-    GL_Texture2D::GL_Texture2D(const Path& path, Boolean flip)
+    GL_Texture2D::GL_Texture2D(UInt32 width, UInt32 height) : m_Serial(s_NextTextureSerial++)
+    {
+        std::vector<UInt8> pixels(width * height * 4, 255);
+        Upload({ pixels.data(), static_cast<Int32>(width), static_cast<Int32>(height), 4, TE::Renderer::TextureFormat::RGBA8 });
+    }
+
+    GL_Texture2D::GL_Texture2D(const Path& path, Boolean flip) : m_Serial(s_NextTextureSerial++)
     {
         if(!std::filesystem::exists(path))
         {
@@ -37,51 +44,138 @@ namespace TE::APIs::OpenGL
 			return;
 		}
 
-        stbi_set_flip_vertically_on_load(flip);
-        m_Data = stbi_load(path.string().c_str(), &m_Width, &m_Height, &m_Channels, 0);
-
-        if (!m_Data) 
+        TE::Renderer::TextureImage image{};
+        if (!TE::Renderer::ReadTextureFile(path, flip, image)) 
         {
             TE_CORE_ERROR("Failed to load texture file -> {0}!", path.string());
             return;
         }
 
-        if (m_Channels == 4) 
+        Upload(image);
+        TE::Renderer::ReleaseTextureImage(image);
+    }
+
+    GL_Texture2D::GL_Texture2D(const TE::Renderer::TextureImage& image) : m_Serial(s_NextTextureSerial++)
+    {
+        Upload(image);
+    }
+
+    GL_Texture2D::GL_Texture2D(const Ref<TE::Renderer::Texture2D>& placeholder) : m_Serial(s_NextTextureSerial++)
+    {
+        m_Placeholder = placeholder;
+    }
+
+    GL_Texture2D::~GL_Texture2D()
+    {
+        ReleaseBindlessHandle();
+        GL_StateCache::ForgetTexture(m_TextureID);
+        glDeleteTextures(1, &m_TextureID);
+    }
+
+    // Storage is immutable, so a texture is only reallocated when its size, format or level count
+    // changes. Only chains supplied by the file are allocated and sampled; a plain image gets one level.
+    // Client pixels are copied by the driver before this returns. A staged image was already written
+    // into the bound pixel-unpack buffer by a loader worker, so the copy runs on the GPU.
+    void GL_Texture2D::Upload(const TE::Renderer::TextureImage& image)
+    {
+        TE::Renderer::TextureFormat format = image.Format;
+        if(format == TE::Renderer::TextureFormat::None)
+            format = (image.Channels == 4) ? TE::Renderer::TextureFormat::RGBA8 : TE::Renderer::TextureFormat::RGB8;
+
+        Boolean compressed = IsCompressed(format);
+        UInt32 internal_format = ToGLInternalFormat(format);
+        UInt32 levels = image.Levels.empty() ? 1 : static_cast<UInt32>(image.Levels.size());
+
+        if(!m_TextureID || m_Width != image.Width || m_Height != image.Height || m_InternalFormat != internal_format || m_MipLevels != levels)
+        {
+            ReleaseBindlessHandle();
+            GL_StateCache::ForgetTexture(m_TextureID);
+            glDeleteTextures(1, &m_TextureID);
+
+            glCreateTextures(GL_TEXTURE_2D, 1, &m_TextureID);
+            glTextureParameteri(m_TextureID, GL_TEXTURE_MIN_FILTER, (levels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+            glTextureParameteri(m_TextureID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTextureParameteri(m_TextureID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTextureParameteri(m_TextureID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            glTextureStorage2D(m_TextureID, levels, internal_format, image.Width, image.Height);
+        }
+
+        m_Width = image.Width;
+        m_Height = image.Height;
+        m_Channels = compressed ? 4 : image.Channels;
+        m_InternalFormat = internal_format;
+        m_DataFormat = (m_Channels == 4) ? GL_RGBA : GL_RGB;
+        m_MipLevels = levels;
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        if(image.Levels.empty())
         {
-			m_InternalFormat    = GL_RGBA8;
-			m_DataFormat        = GL_RGBA;
-		} 
+            glTextureSubImage2D(m_TextureID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, image.Pixels);
+        }
         else
         {
-			m_InternalFormat    = GL_RGB8;
-			m_DataFormat        = GL_RGB;
-		}
+            for(UInt32 level = 0; level < levels; level++)
+            {
+                const TE::Renderer::TextureMipLevel& mip = image.Levels[level];
+                const UInt8* pixels = image.Pixels + mip.Offset;
+                if(compressed)
+                    glCompressedTextureSubImage2D(m_TextureID, level, 0, 0, mip.Width, mip.Height, internal_format, static_cast<GLsizei>(mip.Size), pixels);
+                else
+                    glTextureSubImage2D(m_TextureID, level, 0, 0, mip.Width, mip.Height, m_DataFormat, GL_UNSIGNED_BYTE, pixels);
+            }
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-        glCreateTextures(GL_TEXTURE_2D, 1, &m_TextureID);
-		glBindTexture(GL_TEXTURE_2D, m_TextureID);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexImage2D(GL_TEXTURE_2D, 0, m_InternalFormat, m_Width, m_Height, 0, m_DataFormat, GL_UNSIGNED_BYTE, m_Data);
-		glGenerateMipmap(GL_TEXTURE_2D);
-		m_FromImageFile = TE_TRUE;
+        m_Loaded = TE_TRUE;
+        m_Revision++;
     }
 
-    GL_Texture2D::~GL_Texture2D()
+    void GL_Texture2D::UploadRegion(Int32 x, Int32 y, const TE::Renderer::TextureImage& image)
     {
-        (m_FromImageFile) ? stbi_image_free(m_Data) : delete[] m_Data;
-        glDeleteTextures(1, &m_TextureID);
+        TRIMANA_ASSERT(m_TextureID && image.Levels.empty(), "Regions can only be written into an allocated texture from a single uncompressed image");
+        TRIMANA_ASSERT(x >= 0 && y >= 0 && x + image.Width <= m_Width && y + image.Height <= m_Height, "Texture region is out of bounds");
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTextureSubImage2D(m_TextureID, 0, x, y, image.Width, image.Height, (image.Channels == 4) ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, image.Pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        m_Revision++;
+    }
+
+    // The handle is made resident once per texture, not per table, and goes away with the storage it
+    // points at, so a deleted texture never leaves a resident handle behind.
+    GLuint64 GL_Texture2D::GetBindlessHandle()
+    {
+        if(!m_BindlessHandle && m_TextureID)
+        {
+            m_BindlessHandle = glGetTextureHandleARB(m_TextureID);
+            glMakeTextureHandleResidentARB(m_BindlessHandle);
+        }
+
+        return m_BindlessHandle;
+    }
+
+    void GL_Texture2D::ReleaseBindlessHandle()
+    {
+        if(m_BindlessHandle)
+            glMakeTextureHandleNonResidentARB(m_BindlessHandle);
+
+        m_BindlessHandle = TE_NULL;
     }
 
     void GL_Texture2D::Bind(UInt32 slot) const
     {
-        glBindTextureUnit(slot, m_TextureID);
+        if(IsPending())
+        {
+            m_Placeholder->Bind(slot);
+            return;
+        }
+
+        GL_StateCache::BindTextureUnit(slot, m_TextureID);
     }
 
     void GL_Texture2D::Unbind() const
     {
-        glBindTexture(GL_TEXTURE_2D, 0);
+        GL_StateCache::BindTexture(GL_TEXTURE_2D, 0);
     }
 
 
@@ -10,28 +10,46 @@ namespace TE::APIs::OpenGL
         public:
             GL_Texture2D(UInt32 width, UInt32 height);
             GL_Texture2D(const Path& path, Boolean flip = true);
+            GL_Texture2D(const TE::Renderer::TextureImage& image);
+            GL_Texture2D(const Ref<TE::Renderer::Texture2D>& placeholder);
             virtual ~GL_Texture2D();
 
             virtual void Bind(UInt32 slot = TE_NULL) const override;
             virtual void Unbind() const override;
-            virtual TextureID GetID() const override { return m_TextureID; }
-            virtual Int32 GetWidth() const override { return m_Width; }
-            virtual Int32 GetHeight() const override { return m_Height; }
-            virtual Int32 GetChannels() const override { return m_Channels; }
-            virtual UInt32 GetInternalFormat() const override { return m_InternalFormat; }
-            virtual UInt32 GetDataFormat() const override { return m_DataFormat; }
-            virtual TextureData GetTextureData() const override { return m_Data; }
+            virtual TextureID GetID() const override { return m_TextureID; }   // zero until the upload is done
+            virtual Int32 GetWidth() const override { return IsPending() ? m_Placeholder->GetWidth() : m_Width; }
+            virtual Int32 GetHeight() const override { return IsPending() ? m_Placeholder->GetHeight() : m_Height; }
+            virtual Int32 GetChannels() const override { return IsPending() ? m_Placeholder->GetChannels() : m_Channels; }
+            virtual UInt32 GetInternalFormat() const override { return IsPending() ? m_Placeholder->GetInternalFormat() : m_InternalFormat; }
+            virtual UInt32 GetDataFormat() const override { return IsPending() ? m_Placeholder->GetDataFormat() : m_DataFormat; }
+            virtual UInt32 GetMipLevels() const override { return IsPending() ? m_Placeholder->GetMipLevels() : m_MipLevels; }
+            virtual Boolean IsLoaded() const override { return m_Loaded; }
+            virtual UInt64 GetSerial() const override { return m_Serial; }
+            virtual UInt32 GetRevision() const override { return m_Revision; }
+            virtual void Upload(const TE::Renderer::TextureImage& image) override;
+            virtual void UploadRegion(Int32 x, Int32 y, const TE::Renderer::TextureImage& image) override;
+
+            GLuint64 GetBindlessHandle();
+            const Ref<TE::Renderer::Texture2D>& GetPlaceholder() const { return m_Placeholder; }
+
+        private:
+            Boolean IsPending() const { return !m_Loaded && m_Placeholder; }
+            void ReleaseBindlessHandle();
 
         private:
 
             Int32 m_Width{TE_NULL};              
             Int32 m_Height{TE_NULL};             
             Int32 m_Channels{TE_NULL};           
-            TextureData m_Data{nullptr};          
             TextureID m_TextureID{TE_NULL};       
-            Boolean m_FromImageFile{TE_FALSE};    
+            Boolean m_Loaded{TE_FALSE};    
             UInt32 m_InternalFormat{TE_NULL};     
             UInt32 m_DataFormat{TE_NULL};         
+            UInt32 m_MipLevels{TE_NULL};
+            UInt64 m_Serial{TE_NULL};
+            UInt32 m_Revision{TE_NULL};
+            GLuint64 m_BindlessHandle{TE_NULL};
+            Ref<TE::Renderer::Texture2D> m_Placeholder{nullptr};
     };
 
     class GL_SubTexture2D : public TE::Renderer::SubTexture2D
@@ -0,0 +1,327 @@
+#include <algorithm>
+
+#include "GL_TextureTable.hpp"
+#include "GL_Texture2D.hpp"
+#include "GL_StateCache.hpp"
+#include "Asserts.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    static const UInt32 TEXTURE_TABLE_BINDING       = 0;
+    static const UInt32 INITIAL_HANDLE_CAPACITY     = 256;
+    static const UInt32 MAX_TEXTURE_ARRAYS          = 32;
+    static const UInt32 TEXTURE_ARRAY_LAYERS        = 64;
+    static const UInt32 INITIAL_ARRAY_LAYERS        = 4;
+    static const UInt32 TEXTURE_ARRAY_LAYER_BITS    = 6;
+
+    static const Ref<TE::Renderer::Texture2D>& PendingPlaceholder(const Ref<TE::Renderer::Texture2D>& texture)
+    {
+        static const Ref<TE::Renderer::Texture2D> s_None{ nullptr };
+        if(texture->IsLoaded())
+            return s_None;
+
+        return static_cast<const GL_Texture2D&>(*texture).GetPlaceholder();
+    }
+
+    GL_BindlessTextureTable::GL_BindlessTextureTable()
+    {
+        m_HandleBuffer = TE::Renderer::CreateStorageBuffer(INITIAL_HANDLE_CAPACITY * sizeof(GLuint64));
+    }
+
+    GL_BindlessTextureTable::~GL_BindlessTextureTable()
+    {
+        Clear();
+    }
+
+    Boolean GL_BindlessTextureTable::IsSupported()
+    {
+        return GLAD_GL_ARB_bindless_texture && GLAD_GL_VERSION_4_3;
+    }
+
+    void GL_BindlessTextureTable::Bind() const
+    {
+        m_HandleBuffer->Bind(TEXTURE_TABLE_BINDING);
+    }
+
+    // Residency belongs to the textures, which release their handles when they are destroyed.
+    void GL_BindlessTextureTable::Clear()
+    {
+        m_Handles.clear();
+        m_FreeSlots.clear();
+        m_Entries.clear();
+    }
+
+    UInt32 GL_BindlessTextureTable::GetIndex(const Ref<TE::Renderer::Texture2D>& texture)
+    {
+        const Ref<TE::Renderer::Texture2D>& placeholder = PendingPlaceholder(texture);
+        if(placeholder)
+            return GetIndex(placeholder);
+
+        // A texture that failed to load has no storage to sample; the caller draws it with a fallback.
+        if(!texture->GetID())
+            return TE::Renderer::INVALID_TEXTURE_INDEX;
+
+        auto it = m_Entries.find(texture->GetSerial());
+        if(it != m_Entries.end())
+        {
+            // Reallocated storage comes with a new handle.
+            if(it->second.Revision != texture->GetRevision())
+            {
+                it->second.Revision = texture->GetRevision();
+                WriteHandle(it->second.Index, static_cast<GL_Texture2D&>(*texture).GetBindlessHandle());
+            }
+
+            return it->second.Index;
+        }
+
+        UInt32 index = AllocateSlot();
+        m_Entries[texture->GetSerial()] = { texture, texture->GetRevision(), index };
+        WriteHandle(index, static_cast<GL_Texture2D&>(*texture).GetBindlessHandle());
+        return index;
+    }
+
+    UInt32 GL_BindlessTextureTable::AllocateSlot()
+    {
+        if(m_FreeSlots.empty() && m_Handles.size() * sizeof(GLuint64) >= m_HandleBuffer->GetSize())
+            Prune();
+
+        if(!m_FreeSlots.empty())
+        {
+            UInt32 index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+            return index;
+        }
+
+        m_Handles.emplace_back(TE_NULL);
+        return static_cast<UInt32>(m_Handles.size() - 1);
+    }
+
+    void GL_BindlessTextureTable::WriteHandle(UInt32 index, GLuint64 handle)
+    {
+        m_Handles[index] = handle;
+
+        UInt32 required = static_cast<UInt32>(m_Handles.size() * sizeof(GLuint64));
+        if(required > m_HandleBuffer->GetSize())
+        {
+            m_HandleBuffer = TE::Renderer::CreateStorageBuffer(m_HandleBuffer->GetSize() * 2);
+            m_HandleBuffer->SetData(m_Handles.data(), required);
+            return;
+        }
+
+        m_HandleBuffer->SetData(&handle, sizeof(GLuint64), index * sizeof(GLuint64));
+    }
+
+    void GL_BindlessTextureTable::Prune()
+    {
+        for(auto it = m_Entries.begin(); it != m_Entries.end();)
+        {
+            if(!it->second.Texture.expired())
+            {
+                ++it;
+                continue;
+            }
+
+            m_FreeSlots.emplace_back(it->second.Index);
+            it = m_Entries.erase(it);
+        }
+    }
+
+    GL_ArrayTextureTable::~GL_ArrayTextureTable()
+    {
+        Clear();
+    }
+
+    Boolean GL_ArrayTextureTable::IsSupported()
+    {
+        return GLAD_GL_VERSION_4_5;
+    }
+
+    void GL_ArrayTextureTable::Bind() const
+    {
+        for(UInt32 i = 0; i < m_Arrays.size(); i++)
+            GL_StateCache::BindTextureUnit(i, m_Arrays[i].ID);
+    }
+
+    void GL_ArrayTextureTable::Clear()
+    {
+        for(auto& array : m_Arrays)
+        {
+            GL_StateCache::ForgetTexture(array.ID);
+            glDeleteTextures(1, &array.ID);
+        }
+
+        m_Arrays.clear();
+        m_Entries.clear();
+        m_ReportedFull = TE_FALSE;
+    }
+
+    // Layers are copies, so a texture written after it was first seen (an atlas page receiving new
+    // entries, a streamed texture finishing) is copied again when its revision moves.
+    UInt32 GL_ArrayTextureTable::GetIndex(const Ref<TE::Renderer::Texture2D>& texture)
+    {
+        const Ref<TE::Renderer::Texture2D>& placeholder = PendingPlaceholder(texture);
+        if(placeholder)
+            return GetIndex(placeholder);
+
+        // A texture that failed to load has no storage to sample; the caller draws it with a fallback.
+        if(!texture->GetID())
+            return TE::Renderer::INVALID_TEXTURE_INDEX;
+
+        auto it = m_Entries.find(texture->GetSerial());
+        if(it != m_Entries.end())
+        {
+            GL_TextureTableEntry& entry = it->second;
+            if(entry.Revision == texture->GetRevision())
+                return entry.Index;
+
+            if(!Matches(m_Arrays[entry.Index >> TEXTURE_ARRAY_LAYER_BITS], texture))
+            {
+                UInt32 index = AllocateLayer(texture);
+                if(index == TE::Renderer::INVALID_TEXTURE_INDEX)
+                    return index;
+
+                ReleaseLayer(entry.Index);
+                entry.Index = index;
+            }
+
+            entry.Revision = texture->GetRevision();
+            CopyLayer(texture, entry.Index);
+            return entry.Index;
+        }
+
+        UInt32 index = AllocateLayer(texture);
+        if(index == TE::Renderer::INVALID_TEXTURE_INDEX)
+            return index;
+
+        CopyLayer(texture, index);
+        m_Entries[texture->GetSerial()] = { texture, texture->GetRevision(), index };
+        return index;
+    }
+
+    Boolean GL_ArrayTextureTable::Matches(const TextureArray& array, const Ref<TE::Renderer::Texture2D>& texture) const
+    {
+        return array.Width == texture->GetWidth() && array.Height == texture->GetHeight() && array.InternalFormat == texture->GetInternalFormat() && array.Levels == static_cast<Int32>(texture->GetMipLevels());
+    }
+
+    TextureID GL_ArrayTextureTable::CreateStorage(const TextureArray& array, UInt32 capacity) const
+    {
+        TextureID id{TE_NULL};
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &id);
+        glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, (array.Levels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureStorage3D(id, array.Levels, array.InternalFormat, array.Width, array.Height, capacity);
+        return id;
+    }
+
+    // Arrays start with a few layers and double on overflow. The used layers are copied on the GPU and
+    // Bind() picks up the new name on the next flush, so indices already handed out stay valid.
+    void GL_ArrayTextureTable::Grow(TextureArray& array)
+    {
+        UInt32 capacity = std::min(array.Capacity * 2, TEXTURE_ARRAY_LAYERS);
+        TextureID id = CreateStorage(array, capacity);
+
+        Int32 width = array.Width;
+        Int32 height = array.Height;
+        for(Int32 level = 0; level < array.Levels; level++)
+        {
+            glCopyImageSubData(array.ID, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, id, GL_TEXTURE_2D_ARRAY, level, 0, 0, 0, width, height, array.LayerCount);
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+
+        GL_StateCache::ForgetTexture(array.ID);
+        glDeleteTextures(1, &array.ID);
+        array.ID = id;
+        array.Capacity = capacity;
+    }
+
+    UInt32 GL_ArrayTextureTable::AllocateLayer(const Ref<TE::Renderer::Texture2D>& texture)
+    {
+        for(UInt32 attempt = 0; attempt < 2; attempt++)
+        {
+            for(UInt32 i = 0; i < m_Arrays.size(); i++)
+            {
+                TextureArray& array = m_Arrays[i];
+                if(!Matches(array, texture))
+                    continue;
+
+                if(!array.FreeLayers.empty())
+                {
+                    UInt32 layer = array.FreeLayers.back();
+                    array.FreeLayers.pop_back();
+                    return (i << TEXTURE_ARRAY_LAYER_BITS) | layer;
+                }
+
+                if(array.LayerCount == array.Capacity && array.Capacity < TEXTURE_ARRAY_LAYERS)
+                    Grow(array);
+
+                if(array.LayerCount < array.Capacity)
+                    return (i << TEXTURE_ARRAY_LAYER_BITS) | array.LayerCount++;
+            }
+
+            // Layers of textures that have since been destroyed are only reclaimed when space runs out.
+            if(!attempt)
+                Prune();
+        }
+
+        // The shader addresses at most MAX_TEXTURE_ARRAYS samplers; the caller substitutes a texture it
+        // already holds rather than receiving an index no sampler covers.
+        if(m_Arrays.size() >= MAX_TEXTURE_ARRAYS)
+        {
+            if(!m_ReportedFull)
+                TE_CORE_WARN("Texture array table is full, textures of a new size or format are drawn with a fallback");
+
+            m_ReportedFull = TE_TRUE;
+            return TE::Renderer::INVALID_TEXTURE_INDEX;
+        }
+
+        TextureArray array{};
+        array.Width = texture->GetWidth();
+        array.Height = texture->GetHeight();
+        array.InternalFormat = texture->GetInternalFormat();
+        array.Levels = static_cast<Int32>(texture->GetMipLevels());
+        array.LayerCount = 1;
+        array.Capacity = INITIAL_ARRAY_LAYERS;
+        array.ID = CreateStorage(array, array.Capacity);
+
+        m_Arrays.emplace_back(std::move(array));
+        return static_cast<UInt32>(m_Arrays.size() - 1) << TEXTURE_ARRAY_LAYER_BITS;
+    }
+
+    void GL_ArrayTextureTable::ReleaseLayer(UInt32 index)
+    {
+        m_Arrays[index >> TEXTURE_ARRAY_LAYER_BITS].FreeLayers.emplace_back(index & (TEXTURE_ARRAY_LAYERS - 1));
+    }
+
+    void GL_ArrayTextureTable::CopyLayer(const Ref<TE::Renderer::Texture2D>& texture, UInt32 index)
+    {
+        const TextureArray& array = m_Arrays[index >> TEXTURE_ARRAY_LAYER_BITS];
+        UInt32 layer = index & (TEXTURE_ARRAY_LAYERS - 1);
+
+        Int32 width = array.Width;
+        Int32 height = array.Height;
+        for(Int32 level = 0; level < array.Levels; level++)
+        {
+            glCopyImageSubData(texture->GetID(), GL_TEXTURE_2D, level, 0, 0, 0, array.ID, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer, width, height, 1);
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+    }
+
+    void GL_ArrayTextureTable::Prune()
+    {
+        for(auto it = m_Entries.begin(); it != m_Entries.end();)
+        {
+            if(!it->second.Texture.expired())
+            {
+                ++it;
+                continue;
+            }
+
+            ReleaseLayer(it->second.Index);
+            it = m_Entries.erase(it);
+        }
+    }
+}
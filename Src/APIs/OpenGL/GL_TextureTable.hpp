@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <glad/glad.h>
+
+#include "TypeDef.hpp"
+#include "Buffers.hpp"
+#include "TextureTable.hpp"
+
+namespace TE::APIs::OpenGL
+{
+    // Entries are keyed by the texture serial and hold only a weak reference, so a texture that dies
+    // frees its slot and a GL name recycled by the driver can never inherit it. A changed revision
+    // refreshes the slot; textures still loading resolve to their placeholder's slot.
+    struct GL_TextureTableEntry
+    {
+        WeakRef<TE::Renderer::Texture2D> Texture{};
+        UInt32 Revision{ TE_NULL };
+        UInt32 Index{ TE_NULL };
+    };
+
+    class GL_BindlessTextureTable : public TE::Renderer::TextureTable
+    {
+        public:
+            GL_BindlessTextureTable();
+            virtual ~GL_BindlessTextureTable();
+
+            static Boolean IsSupported();
+
+            virtual void Bind() const override;
+            virtual void Clear() override;
+            virtual UInt32 GetIndex(const Ref<TE::Renderer::Texture2D>& texture) override;
+            virtual UInt32 GetCount() const override { return static_cast<UInt32>(m_Entries.size()); }
+            virtual TE::Renderer::TextureTableType GetType() const override { return TE::Renderer::TextureTableType::Bindless; }
+
+        private:
+            UInt32 AllocateSlot();
+            void WriteHandle(UInt32 index, GLuint64 handle);
+            void Prune();
+
+        private:
+            std::vector<GLuint64> m_Handles;
+            std::vector<UInt32> m_FreeSlots;
+            std::unordered_map<UInt64, GL_TextureTableEntry> m_Entries;
+            Ref<TE::Renderer::StorageBuffer> m_HandleBuffer{nullptr};
+    };
+
+    class GL_ArrayTextureTable : public TE::Renderer::TextureTable
+    {
+        public:
+            GL_ArrayTextureTable() = default;
+            virtual ~GL_ArrayTextureTable();
+
+            static Boolean IsSupported();
+
+            virtual void Bind() const override;
+            virtual void Clear() override;
+            virtual UInt32 GetIndex(const Ref<TE::Renderer::Texture2D>& texture) override;
+            virtual UInt32 GetCount() const override { return static_cast<UInt32>(m_Entries.size()); }
+            virtual TE::Renderer::TextureTableType GetType() const override { return TE::Renderer::TextureTableType::TextureArray; }
+
+        private:
+            struct TextureArray
+            {
+                TextureID ID{TE_NULL};
+                Int32 Width{TE_NULL};
+                Int32 Height{TE_NULL};
+                UInt32 InternalFormat{TE_NULL};
+                Int32 Levels{TE_NULL};
+                UInt32 LayerCount{TE_NULL};
+                UInt32 Capacity{TE_NULL};
+                std::vector<UInt32> FreeLayers;
+            };
+
+            Boolean Matches(const TextureArray& array, const Ref<TE::Renderer::Texture2D>& texture) const;
+            TextureID CreateStorage(const TextureArray& array, UInt32 capacity) const;
+            void Grow(TextureArray& array);
+            UInt32 AllocateLayer(const Ref<TE::Renderer::Texture2D>& texture);
+            void ReleaseLayer(UInt32 index);
+            void CopyLayer(const Ref<TE::Renderer::Texture2D>& texture, UInt32 index);
+            void Prune();
+
+        private:
+            std::vector<TextureArray> m_Arrays;
+            std::unordered_map<UInt64, GL_TextureTableEntry> m_Entries;
+            Boolean m_ReportedFull{TE_FALSE};
+    };
+}
@@ -1,4 +1,5 @@
 #include "GL_VertexArray.hpp"
+#include "GL_StateCache.hpp"
 #include "Asserts.hpp"
 
 namespace TE::APIs::OpenGL
@@ -10,17 +11,18 @@ namespace TE::APIs::OpenGL
 
     GL_VertexArray::~GL_VertexArray()
     {
+        GL_StateCache::ForgetVertexArray(m_VertexArrayID);
         glDeleteVertexArrays(1, &m_VertexArrayID);
     }
 
     void GL_VertexArray::Bind() const
     {
-        glBindVertexArray(m_VertexArrayID);
+        GL_StateCache::BindVertexArray(m_VertexArrayID);
     }
 
     void GL_VertexArray::Unbind() const
     {
-        glBindVertexArray(0);
+        GL_StateCache::BindVertexArray(0);
     }
 
     VertexArrayID GL_VertexArray::GetID() const
@@ -28,49 +30,65 @@ namespace TE::APIs::OpenGL
         return m_VertexArrayID;
     }
 
-    static GLenum GetDataType(TE::Renderer::BufferStride component) 
+    static GLenum GetDataType(TE::Renderer::BufferDataType type) 
     {
-        switch (component) 
+        switch (type) 
         {
-            case TE::Renderer::BufferStride::F1: return GL_FLOAT;
-            case TE::Renderer::BufferStride::F2: return GL_FLOAT;
-            case TE::Renderer::BufferStride::F3: return GL_FLOAT;
-            case TE::Renderer::BufferStride::F4: return GL_FLOAT;
-            case TE::Renderer::BufferStride::MAT3: return GL_FLOAT;
-            case TE::Renderer::BufferStride::MAT4: return GL_FLOAT;
-            default: return 0;
+            case TE::Renderer::BufferDataType::Float: return GL_FLOAT;
+            case TE::Renderer::BufferDataType::Half: return GL_HALF_FLOAT;
+            case TE::Renderer::BufferDataType::Int8: return GL_BYTE;
+            case TE::Renderer::BufferDataType::UInt8: return GL_UNSIGNED_BYTE;
+            case TE::Renderer::BufferDataType::Int16: return GL_SHORT;
+            case TE::Renderer::BufferDataType::UInt16: return GL_UNSIGNED_SHORT;
+            case TE::Renderer::BufferDataType::Int32: return GL_INT;
+            case TE::Renderer::BufferDataType::UInt32: return GL_UNSIGNED_INT;
+            default: break;
         }
 
         TE_CORE_ERROR("Unknown component type");
-        return -1;
+        return GL_FLOAT;
     }
 
     void GL_VertexArray::EmplaceVtxBuffer(const Ref<TE::Renderer::VertexBuffer>& vtxBuffer)
     {
-        glBindVertexArray(m_VertexArrayID);
+        GL_StateCache::BindVertexArray(m_VertexArrayID);
         vtxBuffer->Bind();
         const auto& layout = vtxBuffer->GetLayout();
         const auto& elements = layout.GetElements();
-        UInt32 layout_index{ 0 };
 
         for (auto& element : elements) 
         {
-            glEnableVertexAttribArray(layout_index);
-            glVertexAttribPointer(
-                layout_index,
-                static_cast<GLint>(element.Components),
-                GL_FLOAT,
-                element.Normalized ? GL_TRUE : GL_FALSE,
-                layout.GetStride(),
-                (const void*)element.Offset
-            );
+            glEnableVertexAttribArray(m_AttributeIndex);
+            if(TE::Renderer::IsIntegerDataType(element.Type) && !element.Normalized)
+            {
+                glVertexAttribIPointer(
+                    m_AttributeIndex,
+                    static_cast<GLint>(element.Components),
+                    GetDataType(element.Type),
+                    layout.GetStride(),
+                    (const void*)(std::uintptr_t)element.Offset
+                );
+            }
+            else
+            {
+                glVertexAttribPointer(
+                    m_AttributeIndex,
+                    static_cast<GLint>(element.Components),
+                    GetDataType(element.Type),
+                    element.Normalized ? GL_TRUE : GL_FALSE,
+                    layout.GetStride(),
+                    (const void*)(std::uintptr_t)element.Offset
+                );
+            }
+            glVertexAttribDivisor(m_AttributeIndex, element.Divisor);
+            m_AttributeIndex++;
         }
 
         m_VtxBuffers.emplace_back(vtxBuffer);
     }
     void GL_VertexArray::EmplaceIdxBuffer(const Ref<TE::Renderer::IndexBuffer>& idxBuffer)
     {
-        glBindVertexArray(m_VertexArrayID);
+        GL_StateCache::BindVertexArray(m_VertexArrayID);
         m_IdexBuffer = idxBuffer;
         m_IdexBuffer->Bind();
     }
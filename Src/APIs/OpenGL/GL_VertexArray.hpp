@@ -21,6 +21,7 @@ namespace TE::APIs::OpenGL
 
         private:
             VertexArrayID m_VertexArrayID = 0;
+            UInt32 m_AttributeIndex{TE_NULL};
             std::vector<Ref<TE::Renderer::VertexBuffer>> m_VtxBuffers;
             Ref<TE::Renderer::IndexBuffer> m_IdexBuffer;
     };
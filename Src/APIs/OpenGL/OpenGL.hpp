@@ -1,5 +1,7 @@
 #pragma once
 
+#include "GL_StateCache.hpp"
+#include "GL_ProgramCache.hpp"
 #include "GL_Buffers.hpp"
 #include "GL_Debug.hpp"
 #include "GL_Context.hpp"
@@ -9,3 +11,5 @@
 #include "GL_VertexArray.hpp"
 #include "GL_Texture2D.hpp"
 #include "GL_FrameBuffer.hpp"
+#include "GL_TextureTable.hpp"
+#include "GL_GPUProfiler.hpp"
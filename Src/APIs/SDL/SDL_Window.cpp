@@ -1,5 +1,9 @@
 #include "SDL_Window.hpp"
 #include "Renderer.hpp"
+#include "Instrument.hpp"
+#include "FrameStats.hpp"
+#include "GPUProfiler.hpp"
+#include "TextureLoader.hpp"
 
 namespace TE::APIs::SDL
 {
@@ -107,12 +111,21 @@ namespace TE::APIs::SDL
             SDL_DestroyWindow(m_NativeWindow);
     }
 
+    // The swap closes the frame, so the per-frame hooks run once the Swap stage has been timed.
     void SDLAPI_Window::SwapBuffers()
     {
-        if(TE::Renderer::Renderer::GetAPI() == TE::Renderer::RendererAPI::OpenGL)
         {
-            if(m_Specification.IsActive && m_Specification.IsVSyncEnabled)
-                SDL_GL_SwapWindow(m_NativeWindow);
+            TE::Core::FrameStageScope swap_stage(TE::Core::FrameStage::Swap);
+            if(TE::Renderer::Renderer::GetAPI() == TE::Renderer::RendererAPI::OpenGL)
+            {
+                if(m_Specification.IsActive && m_Specification.IsVSyncEnabled)
+                    SDL_GL_SwapWindow(m_NativeWindow);
+            }
         }
+
+        TE_PROFILE_FRAME();
+        TE_GPU_PROFILE_FRAME();
+        TE::Core::FrameStats::BeginFrame();
+        TE::Renderer::TextureLoader::Update();
     }
 }
\ No newline at end of file
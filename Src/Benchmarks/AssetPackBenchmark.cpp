@@ -0,0 +1,152 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#if defined(TRIMANA_PLATFORM_LINUX)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#include "AssetPack.hpp"
+#include "Logs.hpp"
+
+using namespace TE::Core;
+
+static const UInt32 BENCHMARK_ITERATIONS    = 20;
+
+struct LooseAsset
+{
+    String Name;
+    Path FilePath;
+};
+
+// Asks the kernel to drop the cached pages of a file so the next read has to reach the disk. Only
+// clean pages are dropped, which is all a read-only benchmark ever leaves behind.
+static Boolean EvictFromPageCache(const Path& path)
+{
+    #if defined(TRIMANA_PLATFORM_LINUX)
+        Int32 file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(file < 0)
+            return TE_FALSE;
+
+        Int32 result = posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+        close(file);
+        return result == 0;
+    #else
+        (void)path;
+        return TE_FALSE;
+    #endif
+}
+
+// Reads every loose file the way the loaders did before packs: open, size, allocate, copy.
+static UInt64 LoadLoose(const std::vector<LooseAsset>& assets)
+{
+    UInt64 checksum = 0;
+    std::vector<UInt8> data;
+    for(auto& asset : assets)
+    {
+        std::ifstream in_file(asset.FilePath, std::ios::in | std::ios::binary);
+        in_file.seekg(0, std::ios::end);
+        data.resize(static_cast<size_t>(in_file.tellg()));
+        in_file.seekg(0, std::ios::beg);
+        in_file.read(reinterpret_cast<char*>(data.data()), data.size());
+        for(size_t i = 0; i < data.size(); i += 4096)
+            checksum += data[i];
+    }
+
+    return checksum;
+}
+
+// Opens the pack and touches one byte per page of every asset, which is what a loader reading the
+// span does; compressed entries have to be copied out.
+static UInt64 LoadPack(const Path& packPath, const std::vector<LooseAsset>& assets)
+{
+    AssetPack pack;
+    if(!pack.Open(packPath))
+        return 0;
+
+    UInt64 checksum = 0;
+    std::vector<UInt8> data;
+    for(auto& asset : assets)
+    {
+        std::span<const UInt8> view = pack.View(asset.Name);
+        if(view.empty() && pack.Read(asset.Name, data))
+            view = data;
+
+        for(size_t i = 0; i < view.size(); i += 4096)
+            checksum += view[i];
+    }
+
+    return checksum;
+}
+
+template<typename Function>
+static Double Measure(Function&& load, Boolean cold, const std::vector<Path>& evict, UInt64& checksum)
+{
+    Double total = 0.0;
+    for(UInt32 i = 0; i < BENCHMARK_ITERATIONS; i++)
+    {
+        if(cold)
+        {
+            for(auto& path : evict)
+                EvictFromPageCache(path);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        checksum = load();
+        auto end = std::chrono::steady_clock::now();
+        total += std::chrono::duration<Double, std::milli>(end - start).count();
+    }
+
+    return total / BENCHMARK_ITERATIONS;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        std::fprintf(stderr, "Usage: AssetPackBenchmark <asset directory> <pack built from it by AssetPacker>\n");
+        return 1;
+    }
+
+    LogSystem::Init();
+
+    Path root = argv[1];
+    Path pack_path = argv[2];
+    std::vector<LooseAsset> assets;
+    std::vector<Path> loose_paths;
+    for(auto& file : std::filesystem::recursive_directory_iterator(root))
+    {
+        if(!file.is_regular_file())
+            continue;
+
+        assets.push_back({ std::filesystem::relative(file.path(), root).generic_string(), file.path() });
+        loose_paths.push_back(file.path());
+    }
+
+    std::vector<Path> pack_paths{ pack_path };
+    UInt64 loose_checksum = 0;
+    UInt64 pack_checksum = 0;
+
+    Double warm_loose = Measure([&]() { return LoadLoose(assets); }, TE_FALSE, loose_paths, loose_checksum);
+    Double warm_pack = Measure([&]() { return LoadPack(pack_path, assets); }, TE_FALSE, pack_paths, pack_checksum);
+
+    std::printf("Assets              : %zu\n", assets.size());
+    std::printf("Warm loose files    : %.3f ms\n", warm_loose);
+    std::printf("Warm asset pack     : %.3f ms (%.2fx)\n", warm_pack, warm_loose / warm_pack);
+
+    if(EvictFromPageCache(pack_path))
+    {
+        Double cold_loose = Measure([&]() { return LoadLoose(assets); }, TE_TRUE, loose_paths, loose_checksum);
+        Double cold_pack = Measure([&]() { return LoadPack(pack_path, assets); }, TE_TRUE, pack_paths, pack_checksum);
+        std::printf("Cold loose files    : %.3f ms\n", cold_loose);
+        std::printf("Cold asset pack     : %.3f ms (%.2fx)\n", cold_pack, cold_loose / cold_pack);
+    }
+    else
+        std::printf("Cold runs skipped   : page cache eviction is not available on this platform\n");
+
+    std::printf("Checksums           : %s\n", (loose_checksum == pack_checksum) ? "match" : "MISMATCH");
+    LogSystem::Shutdown();
+    return 0;
+}
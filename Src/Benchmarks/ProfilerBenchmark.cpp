@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "Profiler.hpp"
+#include "Logs.hpp"
+
+using namespace TE::Core;
+
+static const UInt32 BENCHMARK_SCOPES        = 1000000;
+static const UInt32 BENCHMARK_THREADS       = 4;
+
+// Scopes are recorded in bursts of half a ring with a pause in between, the way a frame records them,
+// so the time measured is the cost on the recording thread rather than the writer's serialization
+// competing for the same core.
+static Double MeasureScopes(UInt32 count)
+{
+    const UInt32 burst = PROFILE_BUFFER_CAPACITY / 2;
+    volatile UInt32 sink = 0;
+    Double total = 0.0;
+    for(UInt32 recorded = 0; recorded < count; recorded += burst)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(UInt32 i = 0; i < burst; i++)
+        {
+            ProfileScope scope("ProfilerBenchmark::Scope");
+            sink = sink + i;
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        total += std::chrono::duration<Double, std::nano>(end - start).count();
+        std::this_thread::sleep_for(std::chrono::milliseconds(PROFILE_DRAIN_INTERVAL_MS * 5));
+    }
+
+    return total / ((count + burst - 1) / burst * burst);
+}
+
+// Two clock reads per scope are the floor; reported separately because their cost depends on the
+// platform's clock source far more than on the profiler.
+static Double MeasureClock(UInt32 count)
+{
+    volatile UInt64 sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(UInt32 i = 0; i < count; i++)
+        sink = sink + Profiler::Now();
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<Double, std::nano>(end - start).count() / count;
+}
+
+int main()
+{
+    LogSystem::Init();
+
+    Double clock = MeasureClock(BENCHMARK_SCOPES);
+
+    Double baseline = MeasureScopes(BENCHMARK_SCOPES);
+
+    Profiler::BeginSession("ProfilerBenchmark", "ProfilerBenchmark.json");
+    Double single = MeasureScopes(BENCHMARK_SCOPES);
+
+    std::vector<Double> results(BENCHMARK_THREADS);
+    std::vector<std::thread> threads;
+    for(UInt32 i = 0; i < BENCHMARK_THREADS; i++)
+        threads.emplace_back([&results, i]() { results[i] = MeasureScopes(BENCHMARK_SCOPES / BENCHMARK_THREADS); });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    UInt64 dropped = Profiler::GetDroppedCount();
+    Profiler::EndSession();
+
+    Double threaded = 0.0;
+    for(Double result : results)
+        threaded += result / BENCHMARK_THREADS;
+
+    std::printf("Scopes              : %u\n", BENCHMARK_SCOPES);
+    std::printf("Clock read          : %.1f ns\n", clock);
+    std::printf("Inactive scope      : %.1f ns\n", baseline);
+    std::printf("Recorded scope      : %.1f ns\n", single);
+    std::printf("Recorded scope (%ux): %.1f ns\n", BENCHMARK_THREADS, threaded);
+    std::printf("Dropped events      : %llu\n", dropped);
+
+    LogSystem::Shutdown();
+    return 0;
+}
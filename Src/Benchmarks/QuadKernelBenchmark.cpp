@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "QuadKernel.hpp"
+
+using namespace TE::Renderer;
+
+static const UInt32 BENCHMARK_QUADS         = 20000;
+static const UInt32 BENCHMARK_ITERATIONS    = 200;
+
+using QuadCornerKernel = void (*)(const QuadDesc*, UInt32, Vec2*, UInt32);
+
+static Double Measure(QuadCornerKernel kernel, const std::vector<QuadDesc>& quads, std::vector<Vec2>& corners)
+{
+    kernel(quads.data(), BENCHMARK_QUADS, corners.data(), sizeof(Vec2));
+
+    auto start = std::chrono::steady_clock::now();
+    for(UInt32 i = 0; i < BENCHMARK_ITERATIONS; i++)
+        kernel(quads.data(), BENCHMARK_QUADS, corners.data(), sizeof(Vec2));
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<Double, std::micro>(end - start).count() / BENCHMARK_ITERATIONS;
+}
+
+int main()
+{
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<Float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<Float> size(0.1f, 10.0f);
+    std::uniform_real_distribution<Float> rotation(-3.14159f, 3.14159f);
+
+    std::vector<QuadDesc> quads(BENCHMARK_QUADS);
+    for(auto& quad : quads)
+    {
+        quad.Position   = { position(generator), position(generator), 0.0f };
+        quad.Size       = { size(generator), size(generator) };
+        quad.Rotation   = rotation(generator);
+    }
+
+    std::vector<Vec2> simd_corners(BENCHMARK_QUADS * 4);
+    std::vector<Vec2> scalar_corners(BENCHMARK_QUADS * 4);
+
+    Double simd_time = Measure(WriteQuadCorners, quads, simd_corners);
+    Double scalar_time = Measure(WriteQuadCornersScalar, quads, scalar_corners);
+
+    Float max_error = 0.0f;
+    for(UInt32 i = 0; i < BENCHMARK_QUADS * 4; i++)
+        max_error = std::max(max_error, glm::length(simd_corners[i] - scalar_corners[i]));
+
+    std::printf("Quads per call      : %u\n", BENCHMARK_QUADS);
+    std::printf("Scalar glm          : %.2f us\n", scalar_time);
+    std::printf("Kernel (%s)%*s: %.2f us\n", QuadKernelInstructionSet(), 12 - (int)std::char_traits<char>::length(QuadKernelInstructionSet()), "", simd_time);
+    std::printf("Speed-up            : %.2fx\n", scalar_time / simd_time);
+    std::printf("Max corner error    : %g\n", max_error);
+
+    return 0;
+}
@@ -6,7 +6,7 @@
 #include "Base.hpp"
 
 #ifdef TRIMANA_ASSERTS_ENABLED
-    #define TRIMANA_ASSERT(condition, ...) if(!(condition)) { TE_CORE_CRITICAL("Assertion failed: {0}", __VA_ARGS__); TRIMANA_DEBUGBREAK(); }
+    #define TRIMANA_ASSERT(condition, ...) if(!(condition)) { TE_CORE_CRITICAL("Assertion failed: {0}", __VA_ARGS__); ::TE::Core::LogSystem::Flush(); TRIMANA_DEBUGBREAK(); }
 #else
     #define TRIMANA_ASSERT(condition, ...)
 #endif
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cstring>
+
+#if defined(TRIMANA_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#ifdef TRIMANA_WITH_LZ4
+    #include <lz4.h>
+#endif
+
+#ifdef TRIMANA_WITH_ZSTD
+    #include <zstd.h>
+#endif
+
+#include "AssetPack.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Core
+{
+    AssetPack::~AssetPack()
+    {
+        Close();
+    }
+
+    Boolean AssetPack::Open(const Path& path)
+    {
+        Close();
+
+        #if defined(TRIMANA_PLATFORM_WINDOWS)
+
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+            if(file == INVALID_HANDLE_VALUE)
+            {
+                TE_CORE_ERROR("Failed to open asset pack {0}", path.string());
+                return TE_FALSE;
+            }
+
+            LARGE_INTEGER size{};
+            GetFileSizeEx(file, &size);
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if(!mapping)
+            {
+                TE_CORE_ERROR("Failed to map asset pack {0}", path.string());
+                return TE_FALSE;
+            }
+
+            const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if(!view)
+            {
+                TE_CORE_ERROR("Failed to map asset pack {0}", path.string());
+                CloseHandle(mapping);
+                return TE_FALSE;
+            }
+
+            m_Data = static_cast<const UInt8*>(view);
+            m_Size = static_cast<UInt64>(size.QuadPart);
+            m_MappingHandle = mapping;
+
+        #else
+
+            Int32 file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if(file < 0)
+            {
+                TE_CORE_ERROR("Failed to open asset pack {0}", path.string());
+                return TE_FALSE;
+            }
+
+            struct stat info{};
+            fstat(file, &info);
+            void* mapped = (info.st_size > 0) ? mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+            close(file);
+            if(mapped == MAP_FAILED)
+            {
+                TE_CORE_ERROR("Failed to map asset pack {0}", path.string());
+                return TE_FALSE;
+            }
+
+            m_Data = static_cast<const UInt8*>(mapped);
+            m_Size = static_cast<UInt64>(info.st_size);
+
+        #endif
+
+        m_Header = reinterpret_cast<const AssetPackHeader*>(m_Data);
+        if(m_Size < sizeof(AssetPackHeader) || m_Header->Magic != ASSET_PACK_MAGIC || m_Header->Version != ASSET_PACK_VERSION ||
+           m_Header->TocOffset + static_cast<UInt64>(m_Header->EntryCount) * sizeof(AssetPackEntry) > m_Size ||
+           m_Header->NamesOffset + m_Header->NamesSize > m_Size)
+        {
+            TE_CORE_ERROR("{0} is not a valid asset pack", path.string());
+            Close();
+            return TE_FALSE;
+        }
+
+        m_Entries = reinterpret_cast<const AssetPackEntry*>(m_Data + m_Header->TocOffset);
+        m_Names = reinterpret_cast<const char*>(m_Data + m_Header->NamesOffset);
+        return TE_TRUE;
+    }
+
+    void AssetPack::Close()
+    {
+        if(!m_Data)
+            return;
+
+        #if defined(TRIMANA_PLATFORM_WINDOWS)
+            UnmapViewOfFile(m_Data);
+            CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+        #else
+            munmap(const_cast<UInt8*>(m_Data), static_cast<size_t>(m_Size));
+        #endif
+
+        m_Data = nullptr;
+        m_Size = TE_NULL;
+        m_Header = nullptr;
+        m_Entries = nullptr;
+        m_Names = nullptr;
+        m_MappingHandle = nullptr;
+    }
+
+    const AssetPackEntry* AssetPack::Find(std::string_view name) const
+    {
+        if(!m_Data)
+            return nullptr;
+
+        UInt64 hash = HashAssetName(name);
+        const AssetPackEntry* end = m_Entries + m_Header->EntryCount;
+        const AssetPackEntry* it = std::lower_bound(m_Entries, end, hash, [](const AssetPackEntry& entry, UInt64 value) { return entry.NameHash < value; });
+        for(; it != end && it->NameHash == hash; ++it)
+        {
+            if(AssetNamesEqual(GetEntryName(*it), name))
+                return it;
+        }
+
+        return nullptr;
+    }
+
+    std::span<const UInt8> AssetPack::View(std::string_view name) const
+    {
+        const AssetPackEntry* entry = Find(name);
+        if(!entry || entry->Compression != AssetCompression::None || entry->Offset + entry->Size > m_Size)
+            return {};
+
+        return { m_Data + entry->Offset, static_cast<size_t>(entry->Size) };
+    }
+
+    Boolean AssetPack::Read(std::string_view name, std::vector<UInt8>& data) const
+    {
+        const AssetPackEntry* entry = Find(name);
+        if(!entry || entry->Offset + entry->StoredSize > m_Size)
+            return TE_FALSE;
+
+        const UInt8* stored = m_Data + entry->Offset;
+        data.resize(static_cast<size_t>(entry->Size));
+        switch(entry->Compression)
+        {
+            case AssetCompression::None:
+            {
+                if(entry->StoredSize != entry->Size)
+                {
+                    data.clear();
+                    return TE_FALSE;
+                }
+
+                std::memcpy(data.data(), stored, data.size());
+                return TE_TRUE;
+            }
+            #ifdef TRIMANA_WITH_LZ4
+            case AssetCompression::LZ4:
+            {
+                Int32 written = LZ4_decompress_safe(reinterpret_cast<const char*>(stored), reinterpret_cast<char*>(data.data()), static_cast<Int32>(entry->StoredSize), static_cast<Int32>(entry->Size));
+                return written == static_cast<Int32>(entry->Size);
+            }
+            #endif
+            #ifdef TRIMANA_WITH_ZSTD
+            case AssetCompression::Zstd:
+            {
+                size_t written = ZSTD_decompress(data.data(), data.size(), stored, static_cast<size_t>(entry->StoredSize));
+                return !ZSTD_isError(written) && written == entry->Size;
+            }
+            #endif
+            default:
+            {
+                TE_CORE_ERROR("Asset {0} uses a compression scheme this build does not support", GetEntryName(*entry));
+                data.clear();
+                return TE_FALSE;
+            }
+        }
+    }
+
+    // Names are read within the name table, so a corrupt offset or a missing terminator cannot run
+    // past the mapping.
+    std::string_view AssetPack::GetEntryName(const AssetPackEntry& entry) const
+    {
+        if(entry.NameOffset >= m_Header->NamesSize)
+            return {};
+
+        const char* name = m_Names + entry.NameOffset;
+        return std::string_view(name, strnlen(name, m_Header->NamesSize - entry.NameOffset));
+    }
+
+    Boolean AssetPack::IsCompressionSupported(AssetCompression compression)
+    {
+        switch(compression)
+        {
+            case AssetCompression::None:    return TE_TRUE;
+            #ifdef TRIMANA_WITH_LZ4
+            case AssetCompression::LZ4:     return TE_TRUE;
+            #endif
+            #ifdef TRIMANA_WITH_ZSTD
+            case AssetCompression::Zstd:    return TE_TRUE;
+            #endif
+            default:                        return TE_FALSE;
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <string_view>
+
+#include "TypeDef.hpp"
+
+namespace TE::Core
+{
+    static const UInt32 ASSET_PACK_MAGIC        = 0x4B504554;   // "TEPK"
+    static const UInt32 ASSET_PACK_VERSION      = 1;
+    static const UInt64 ASSET_PACK_ALIGNMENT    = 64;
+
+    enum class AssetCompression : UInt32
+    {
+        None    = 0,
+        LZ4     = 1,
+        Zstd    = 2
+    };
+
+    struct AssetPackHeader
+    {
+        UInt32 Magic{ ASSET_PACK_MAGIC };
+        UInt32 Version{ ASSET_PACK_VERSION };
+        UInt32 EntryCount{ TE_NULL };
+        UInt32 NamesSize{ TE_NULL };
+        UInt64 TocOffset{ TE_NULL };
+        UInt64 NamesOffset{ TE_NULL };
+    };
+
+    // Entries are stored sorted by NameHash so lookups are a binary search over the mapped table.
+    struct AssetPackEntry
+    {
+        UInt64 NameHash{ TE_NULL };
+        UInt64 Offset{ TE_NULL };
+        UInt64 StoredSize{ TE_NULL };
+        UInt64 Size{ TE_NULL };
+        AssetCompression Compression{ AssetCompression::None };
+        UInt32 NameOffset{ TE_NULL };
+    };
+
+    static_assert(sizeof(AssetPackHeader) == 32 && sizeof(AssetPackEntry) == 40, "Asset pack structures must match the on-disk layout");
+
+    constexpr char NormalizeAssetNameChar(char c)
+    {
+        return (c == '\\') ? '/' : c;
+    }
+
+    constexpr UInt64 HashAssetName(std::string_view name)
+    {
+        UInt64 hash = 14695981039346656037ull;
+        for(char c : name)
+        {
+            hash ^= static_cast<UInt8>(NormalizeAssetNameChar(c));
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // Compares the way HashAssetName hashes, so either path separator finds the entry.
+    constexpr Boolean AssetNamesEqual(std::string_view a, std::string_view b)
+    {
+        if(a.size() != b.size())
+            return TE_FALSE;
+
+        for(size_t i = 0; i < a.size(); i++)
+        {
+            if(NormalizeAssetNameChar(a[i]) != NormalizeAssetNameChar(b[i]))
+                return TE_FALSE;
+        }
+        return TE_TRUE;
+    }
+
+    // Read-only archive mapped into memory. Uncompressed entries are handed out as spans into the
+    // mapping, so they stay valid until Close() and are never copied.
+    class AssetPack
+    {
+        public:
+            AssetPack() = default;
+            ~AssetPack();
+
+            AssetPack(const AssetPack&) = delete;
+            AssetPack& operator=(const AssetPack&) = delete;
+
+            Boolean Open(const Path& path);
+            void Close();
+            Boolean IsOpen() const { return m_Data != nullptr; }
+
+            const AssetPackEntry* Find(std::string_view name) const;
+            Boolean Contains(std::string_view name) const { return Find(name) != nullptr; }
+            std::span<const UInt8> View(std::string_view name) const;
+            Boolean Read(std::string_view name, std::vector<UInt8>& data) const;
+
+            UInt32 GetEntryCount() const { return m_Header ? m_Header->EntryCount : TE_NULL; }
+            const AssetPackEntry& GetEntry(UInt32 index) const { return m_Entries[index]; }
+            std::string_view GetEntryName(const AssetPackEntry& entry) const;
+
+            static Boolean IsCompressionSupported(AssetCompression compression);
+
+        private:
+            const UInt8* m_Data{ nullptr };
+            UInt64 m_Size{ TE_NULL };
+            const AssetPackHeader* m_Header{ nullptr };
+            const AssetPackEntry* m_Entries{ nullptr };
+            const char* m_Names{ nullptr };
+            void* m_MappingHandle{ nullptr };
+    };
+}
@@ -0,0 +1,253 @@
+#include <bit>
+#include <chrono>
+#include <algorithm>
+
+#include "FrameStats.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Core
+{
+    static const UInt32 FRAME_STAGE_COUNT = static_cast<UInt32>(FrameStage::Count);
+
+    struct FrameStageData
+    {
+        FrameHistogram Histogram;
+        UInt64 Hitches{ TE_NULL };
+        UInt64 Accumulated{ TE_NULL };      // nanoseconds spent in the stage this frame
+        UInt64 Started{ TE_NULL };
+        Boolean Touched{ TE_FALSE };
+    };
+
+    struct FrameStatsData
+    {
+        std::array<FrameStageData, FRAME_STAGE_COUNT> Stages;
+        UInt64 FrameStart{ TE_NULL };
+        UInt64 LastFrameTime{ TE_NULL };
+        UInt64 ElapsedTime{ TE_NULL };
+        Double HitchFactor{ 2.0 };
+
+    }; static FrameStatsData s_FrameStatsData;
+
+    static CString s_FrameStageNames[FRAME_STAGE_COUNT] = { "Frame", "Update", "Submit", "Swap" };
+
+    static UInt64 FrameStatsNow()
+    {
+        return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static Double MicrosecondsToMilliseconds(UInt64 microseconds)
+    {
+        return static_cast<Double>(microseconds) / 1000.0;
+    }
+
+    UInt32 FrameHistogram::BucketIndex(UInt32 value)
+    {
+        value = std::min(value, (2u << FRAME_STATS_MAX_MSB) - 1);
+        if(value < 2 * FRAME_STATS_SUB_BUCKETS)
+            return value;
+
+        UInt32 shift = static_cast<UInt32>(std::bit_width(value)) - 1 - FRAME_STATS_SUB_BUCKET_BITS;
+        return shift * FRAME_STATS_SUB_BUCKETS + (value >> shift);
+    }
+
+    UInt32 FrameHistogram::BucketHighestValue(UInt32 index)
+    {
+        if(index < 2 * FRAME_STATS_SUB_BUCKETS)
+            return index;
+
+        UInt32 shift = index / FRAME_STATS_SUB_BUCKETS - 1;
+        UInt32 mantissa = index - shift * FRAME_STATS_SUB_BUCKETS;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    void FrameHistogram::Record(UInt32 microseconds)
+    {
+        if(m_Count == FRAME_STATS_WINDOW)
+        {
+            UInt32 evicted = m_Samples[m_Next];
+            m_Buckets[BucketIndex(evicted)]--;
+            m_Sum -= evicted;
+        }
+        else
+        {
+            m_Count++;
+        }
+
+        m_Samples[m_Next] = microseconds;
+        m_Buckets[BucketIndex(microseconds)]++;
+        m_Sum += microseconds;
+        m_Next = (m_Next + 1) % FRAME_STATS_WINDOW;
+    }
+
+    void FrameHistogram::Reset()
+    {
+        m_Buckets.fill(TE_NULL);
+        m_Next = TE_NULL;
+        m_Count = TE_NULL;
+        m_Sum = TE_NULL;
+    }
+
+    UInt32 FrameHistogram::GetSample(UInt32 index) const
+    {
+        TRIMANA_ASSERT(index < m_Count, "Frame histogram sample index out of range");
+        UInt32 oldest = (m_Count == FRAME_STATS_WINDOW) ? m_Next : TE_NULL;
+        return m_Samples[(oldest + index) % FRAME_STATS_WINDOW];
+    }
+
+    // Reports the highest value that falls in the bucket holding the requested rank, capped by the
+    // window maximum so p99 never reads above max.
+    UInt32 FrameHistogram::GetPercentile(Double percentile) const
+    {
+        if(!m_Count)
+            return TE_NULL;
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        UInt64 rank = std::max<UInt64>(1, static_cast<UInt64>(percentile / 100.0 * m_Count + 0.5));
+        UInt64 seen = TE_NULL;
+        for(UInt32 i = 0; i < FRAME_STATS_BUCKET_COUNT; i++)
+        {
+            seen += m_Buckets[i];
+            if(seen >= rank)
+                return std::min(BucketHighestValue(i), GetMax());
+        }
+
+        return GetMax();
+    }
+
+    UInt32 FrameHistogram::GetMax() const
+    {
+        UInt32 max = TE_NULL;
+        for(UInt32 i = 0; i < m_Count; i++)
+            max = std::max(max, m_Samples[i]);
+
+        return max;
+    }
+
+    Double FrameHistogram::GetMean() const
+    {
+        return m_Count ? static_cast<Double>(m_Sum) / m_Count : 0.0;
+    }
+
+    static void RecordStage(FrameStageData& stage, UInt64 nanoseconds)
+    {
+        UInt32 microseconds = static_cast<UInt32>(std::min<UInt64>(nanoseconds / 1000, 0xFFFFFFFF));
+        if(stage.Histogram.GetCount() >= FRAME_STATS_HITCH_MIN_SAMPLES &&
+           microseconds > stage.Histogram.GetPercentile(50.0) * s_FrameStatsData.HitchFactor)
+            stage.Hitches++;
+
+        stage.Histogram.Record(microseconds);
+    }
+
+    void FrameStats::BeginFrame()
+    {
+        UInt64 now = FrameStatsNow();
+        if(s_FrameStatsData.FrameStart)
+        {
+            s_FrameStatsData.LastFrameTime = now - s_FrameStatsData.FrameStart;
+            s_FrameStatsData.ElapsedTime += s_FrameStatsData.LastFrameTime;
+            RecordStage(s_FrameStatsData.Stages[static_cast<UInt32>(FrameStage::Frame)], s_FrameStatsData.LastFrameTime);
+
+            for(UInt32 i = static_cast<UInt32>(FrameStage::Update); i < FRAME_STAGE_COUNT; i++)
+            {
+                FrameStageData& stage = s_FrameStatsData.Stages[i];
+                if(stage.Touched)
+                    RecordStage(stage, stage.Accumulated);
+
+                stage.Accumulated = TE_NULL;
+                stage.Touched = TE_FALSE;
+            }
+        }
+
+        s_FrameStatsData.FrameStart = now;
+    }
+
+    void FrameStats::BeginStage(FrameStage stage)
+    {
+        TRIMANA_ASSERT(stage != FrameStage::Frame && stage < FrameStage::Count, "Frame time is measured by BeginFrame");
+        s_FrameStatsData.Stages[static_cast<UInt32>(stage)].Started = FrameStatsNow();
+    }
+
+    void FrameStats::EndStage(FrameStage stage)
+    {
+        FrameStageData& data = s_FrameStatsData.Stages[static_cast<UInt32>(stage)];
+        data.Accumulated += FrameStatsNow() - data.Started;
+        data.Touched = TE_TRUE;
+    }
+
+    void FrameStats::Reset()
+    {
+        for(auto& stage : s_FrameStatsData.Stages)
+        {
+            stage.Histogram.Reset();
+            stage.Hitches = TE_NULL;
+            stage.Accumulated = TE_NULL;
+            stage.Touched = TE_FALSE;
+        }
+
+        s_FrameStatsData.FrameStart = TE_NULL;
+        s_FrameStatsData.LastFrameTime = TE_NULL;
+    }
+
+    Timer FrameStats::GetFrameTime()
+    {
+        return Timer(static_cast<Float>(static_cast<Double>(s_FrameStatsData.LastFrameTime) / 1e9));
+    }
+
+    // Seconds of completed frames since the first BeginFrame(); Reset() only clears the statistics.
+    Double FrameStats::GetElapsedTime()
+    {
+        return static_cast<Double>(s_FrameStatsData.ElapsedTime) / 1e9;
+    }
+
+    const FrameHistogram& FrameStats::GetHistogram(FrameStage stage)
+    {
+        TRIMANA_ASSERT(stage < FrameStage::Count, "Invalid frame stage");
+        return s_FrameStatsData.Stages[static_cast<UInt32>(stage)].Histogram;
+    }
+
+    FrameStatsSummary FrameStats::GetSummary(FrameStage stage)
+    {
+        const FrameStageData& data = s_FrameStatsData.Stages[static_cast<UInt32>(stage)];
+
+        FrameStatsSummary summary{};
+        summary.Samples = data.Histogram.GetCount();
+        summary.Mean = data.Histogram.GetMean() / 1000.0;
+        summary.P50 = MicrosecondsToMilliseconds(data.Histogram.GetPercentile(50.0));
+        summary.P95 = MicrosecondsToMilliseconds(data.Histogram.GetPercentile(95.0));
+        summary.P99 = MicrosecondsToMilliseconds(data.Histogram.GetPercentile(99.0));
+        summary.Max = MicrosecondsToMilliseconds(data.Histogram.GetMax());
+        summary.Hitches = data.Hitches;
+        return summary;
+    }
+
+    CString FrameStats::GetStageName(FrameStage stage)
+    {
+        return stage < FrameStage::Count ? s_FrameStageNames[static_cast<UInt32>(stage)] : "Unknown";
+    }
+
+    void FrameStats::SetHitchFactor(Double factor)
+    {
+        TRIMANA_ASSERT(factor > 1.0, "Hitch factor must be above 1");
+        s_FrameStatsData.HitchFactor = factor;
+    }
+
+    Boolean FrameStats::ExportCSV(const Path& filepath)
+    {
+        std::ofstream file(filepath, std::ios::out | std::ios::trunc);
+        if(!file.is_open())
+        {
+            TE_CORE_ERROR("Could not open frame stats file {0}", filepath.string());
+            return TE_FALSE;
+        }
+
+        file << "stage,samples,mean_ms,p50_ms,p95_ms,p99_ms,max_ms,hitches\n";
+        for(UInt32 i = 0; i < FRAME_STAGE_COUNT; i++)
+        {
+            FrameStatsSummary summary = GetSummary(static_cast<FrameStage>(i));
+            file << s_FrameStageNames[i] << ',' << summary.Samples << ',' << summary.Mean << ',' << summary.P50 << ','
+                 << summary.P95 << ',' << summary.P99 << ',' << summary.Max << ',' << summary.Hitches << '\n';
+        }
+
+        return file.good() ? TE_TRUE : TE_FALSE;
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+
+#include "TypeDef.hpp"
+#include "Timer.hpp"
+
+namespace TE::Core
+{
+    static const UInt32 FRAME_STATS_WINDOW              = 1024;     // frames kept per distribution
+    static const UInt32 FRAME_STATS_SUB_BUCKET_BITS     = 5;        // 32 buckets per octave, under 3.2% error
+    static const UInt32 FRAME_STATS_SUB_BUCKETS         = 1 << FRAME_STATS_SUB_BUCKET_BITS;
+    static const UInt32 FRAME_STATS_MAX_MSB             = 25;       // samples clamp at ~67 s
+    static const UInt32 FRAME_STATS_BUCKET_COUNT        = (FRAME_STATS_MAX_MSB - FRAME_STATS_SUB_BUCKET_BITS + 2) * FRAME_STATS_SUB_BUCKETS;
+    static const UInt32 FRAME_STATS_HITCH_MIN_SAMPLES   = 30;       // frames before the median is trusted
+
+    enum class FrameStage : UInt32
+    {
+        Frame   = 0,
+        Update  = 1,
+        Submit  = 2,
+        Swap    = 3,
+        Count   = 4
+    };
+
+    struct FrameStatsSummary
+    {
+        UInt32 Samples{ TE_NULL };
+        Double Mean{ 0.0 };             // all times in milliseconds
+        Double P50{ 0.0 };
+        Double P95{ 0.0 };
+        Double P99{ 0.0 };
+        Double Max{ 0.0 };
+        UInt64 Hitches{ TE_NULL };      // since the last reset
+    };
+
+    // Rolling log-linear histogram over the last FRAME_STATS_WINDOW samples, in microseconds. Values
+    // below 2 * FRAME_STATS_SUB_BUCKETS get a bucket each; above that every power of two is split into
+    // FRAME_STATS_SUB_BUCKETS buckets, so recording and evicting a sample is a couple of shifts.
+    class FrameHistogram
+    {
+        public:
+            FrameHistogram() = default;
+            ~FrameHistogram() = default;
+
+            void Record(UInt32 microseconds);
+            void Reset();
+
+            UInt32 GetCount() const { return m_Count; }
+            UInt32 GetSample(UInt32 index) const;       // 0 is the oldest sample in the window
+            UInt32 GetPercentile(Double percentile) const;
+            UInt32 GetMax() const;
+            Double GetMean() const;
+
+        private:
+            static UInt32 BucketIndex(UInt32 value);
+            static UInt32 BucketHighestValue(UInt32 index);
+
+        private:
+            std::array<UInt32, FRAME_STATS_WINDOW> m_Samples{};
+            std::array<UInt32, FRAME_STATS_BUCKET_COUNT> m_Buckets{};
+            UInt32 m_Next{ TE_NULL };
+            UInt32 m_Count{ TE_NULL };
+            UInt64 m_Sum{ TE_NULL };
+    };
+
+    // Per-frame timing of the main loop stages. BeginFrame() closes the previous frame: the time since
+    // the last BeginFrame() becomes the frame time and every stage timed during that frame is recorded.
+    // A stage may be entered several times per frame (each Renderer2D flush, for instance); its
+    // intervals are summed. A sample counts as a hitch when it exceeds the hitch factor times the
+    // rolling median. Main thread only.
+    class FrameStats
+    {
+        private:
+            FrameStats() = default;
+            ~FrameStats() = default;
+
+        public:
+            static void BeginFrame();
+            static void BeginStage(FrameStage stage);
+            static void EndStage(FrameStage stage);
+            static void Reset();
+
+            static Timer GetFrameTime();
+            static Double GetElapsedTime();
+            static const FrameHistogram& GetHistogram(FrameStage stage);
+            static FrameStatsSummary GetSummary(FrameStage stage);
+            static CString GetStageName(FrameStage stage);
+
+            static void SetHitchFactor(Double factor);
+            static Boolean ExportCSV(const Path& filepath);
+    };
+
+    class FrameStageScope
+    {
+        public:
+            explicit FrameStageScope(FrameStage stage) : m_Stage(stage) { FrameStats::BeginStage(m_Stage); }
+            ~FrameStageScope() { FrameStats::EndStage(m_Stage); }
+
+            FrameStageScope(const FrameStageScope&) = delete;
+            FrameStageScope& operator=(const FrameStageScope&) = delete;
+
+        private:
+            FrameStage m_Stage;
+    };
+}
+
+#define TE_FRAME_STAGE_CONCAT_IMPL(a, b) a##b
+#define TE_FRAME_STAGE_CONCAT(a, b) TE_FRAME_STAGE_CONCAT_IMPL(a, b)
+#define TE_FRAME_STAGE(stage) TE::Core::FrameStageScope TE_FRAME_STAGE_CONCAT(frame_stage_, __LINE__)(TE::Core::FrameStage::stage)
@@ -2,138 +2,39 @@
 
 #include "Base.hpp"
 
-#ifdef TE_INSTRUMENTS_ENABLED
+#ifdef TRIMANA_INSTRUMENTS_ENABLED
 
-#include <string>
-#include <chrono>
-#include <algorithm>
-#include <fstream>
-#include <thread>
+#include "Profiler.hpp"
 
-namespace TE::Cherno 
-{
-    struct ProfileResult 
-    {
-        std::string Name;
-        long long Start, End;
-        uint32_t ThreadID;
-    };
-
-    struct InstrumentationSession 
-    {
-        std::string Name;
-    };
-
-    class Instrumentor 
-    {
-        private:
-            InstrumentationSession* m_CurrentSession;
-            std::ofstream m_OutputStream;
-            int m_ProfileCount;
-
-        public:
-            Instrumentor(): m_CurrentSession(nullptr), m_ProfileCount(0) {}
-
-            void BeginSession(const std::string& name, const std::string& filepath = "results.json") 
-            {
-                m_OutputStream.open(filepath);
-                WriteHeader();
-                m_CurrentSession = new InstrumentationSession{ name };
-            }
-
-            void EndSession() 
-            {
-                WriteFooter();
-                m_OutputStream.close();
-                delete m_CurrentSession;
-                m_CurrentSession = nullptr;
-                m_ProfileCount = 0;
-            }
-
-            void WriteProfile(const ProfileResult& result) 
-            {
-                if (m_ProfileCount++ > 0)
-                    m_OutputStream << ",";
-
-                std::string name = result.Name;
-                std::replace(name.begin(), name.end(), '"', '\'');
-
-                m_OutputStream << "{";
-                m_OutputStream << "\"cat\":\"function\",";
-                m_OutputStream << "\"dur\":" << (result.End - result.Start) << ',';
-                m_OutputStream << "\"name\":\"" << name << "\",";
-                m_OutputStream << "\"ph\":\"X\",";
-                m_OutputStream << "\"pid\":0,";
-                m_OutputStream << "\"tid\":" << result.ThreadID << ",";
-                m_OutputStream << "\"ts\":" << result.Start;
-                m_OutputStream << "}";
-
-                m_OutputStream.flush();
-            }
-
-            void WriteHeader() 
-            {
-                m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
-                m_OutputStream.flush();
-            }
-
-            void WriteFooter() 
-            {
-                m_OutputStream << "]}";
-                m_OutputStream.flush();
-            }
-
-            static Instrumentor& Get() 
-            {
-                static Instrumentor instance;
-                return instance;
-            }
-    };
-
-    class InstrumentationTimer 
-    {
-        public:
-            InstrumentationTimer(const char* name): m_Name(name), m_Stopped(false) 
-            {
-                m_StartTimepoint = std::chrono::high_resolution_clock::now();
-            }
-
-            ~InstrumentationTimer() 
-            {
-                if (!m_Stopped)
-                    Stop();
-            }
-
-            void Stop() 
-            {
-                auto endTimepoint = std::chrono::high_resolution_clock::now();
-
-                long long start = std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch().count();
-                long long end = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch().count();
-
-                uint32_t threadID = std::hash<std::thread::id>{}(std::this_thread::get_id());
-                Instrumentor::Get().WriteProfile({ m_Name, start, end, threadID });
-
-                m_Stopped = true;
-            }
-            
-        private:
-            const char* m_Name;
-            std::chrono::time_point<std::chrono::high_resolution_clock> m_StartTimepoint;
-            bool m_Stopped;
-    };
-}
-
-#define TE_BEGIN_SESSION(name, filepath) TE::Cherno::Instrumentor::Get().BeginSession(name, filepath)
-#define TE_END_SESSION() TE::Cherno::Instrumentor::Get().EndSession()
-#define TE_PROFILE_SCOPE(name) TE::Cherno::InstrumentationTimer timer##__LINE__(name)
-#define TE_PROFILE_FUNCTION() TE_PROFILE_SCOPE(__FUNCSIG__)
+#if defined(_MSC_VER)
+    #define TE_FUNCTION_SIGNATURE __FUNCSIG__
+#else
+    #define TE_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#endif
+
+#define TE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TE_PROFILE_CONCAT(a, b) TE_PROFILE_CONCAT_IMPL(a, b)
+
+#define TE_BEGIN_SESSION(name, filepath) TE::Core::Profiler::BeginSession(name, filepath)
+#define TE_END_SESSION() TE::Core::Profiler::EndSession()
+#define TE_PROFILE_SCOPE(name) TE::Core::ProfileScope TE_PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+#define TE_PROFILE_FUNCTION() TE_PROFILE_SCOPE(TE_FUNCTION_SIGNATURE)
+#define TE_PROFILE_THREAD(name) TE::Core::Profiler::SetThreadName(name)
+#define TE_PROFILE_FRAME() TE::Core::Profiler::MarkFrame()
+#define TE_PROFILE_COUNTER(name, value) TE::Core::Profiler::Counter(name, static_cast<Double>(value))
+#define TE_PROFILE_FLOW_BEGIN(name, id) TE::Core::Profiler::FlowBegin(name, id)
+#define TE_PROFILE_FLOW_END(name, id) TE::Core::Profiler::FlowEnd(name, id)
 
 #else
 
 #define TE_BEGIN_SESSION(name, filepath)
-#define TE_END_SESSION() 
+#define TE_END_SESSION()
 #define TE_PROFILE_SCOPE(name)
-#define TE_PROFILE_FUNCTION() 
-
-#endif
\ No newline at end of file
+#define TE_PROFILE_FUNCTION()
+#define TE_PROFILE_THREAD(name) (void)(name)
+#define TE_PROFILE_FRAME()
+#define TE_PROFILE_COUNTER(name, value)
+#define TE_PROFILE_FLOW_BEGIN(name, id)
+#define TE_PROFILE_FLOW_END(name, id)
+
+#endif
@@ -1,4 +1,5 @@
 #include "LayerStack.hpp"
+#include "FrameStats.hpp"
 
 namespace TE::Core
 {
@@ -41,5 +42,13 @@ namespace TE::Core
         }
     }
 
-
+    // Timed as the Update stage of the frame stats.
+    void LayerStack::OnUpdate(Timer deltaTime)
+    {
+        TE_FRAME_STAGE(Update);
+        for(auto& layer : m_Layers)
+        {
+            layer->OnUpdate(deltaTime);
+        }
+    }
 }
\ No newline at end of file
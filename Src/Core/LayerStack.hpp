@@ -14,6 +14,7 @@ namespace TE::Core
             void PushOverlay(Ref<Layer> overlay);
             void PopLayer(Ref<Layer> layer);
             void PopOverlay(Ref<Layer> overlay);
+            void OnUpdate(Timer deltaTime);
 
             std::vector<Ref<Layer>>::iterator begin() { return m_Layers.begin(); }
             std::vector<Ref<Layer>>::iterator end() { return m_Layers.end(); }
@@ -1,46 +1,212 @@
+#include <mutex>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <condition_variable>
+
 #include "Logs.hpp"
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/base_sink.h>
 
 namespace TE::Core
 {
-    static Boolean s_Initialized = TE_FALSE;
+    static std::mutex s_StateMutex;
+    static std::atomic<Boolean> s_Initialized{ TE_FALSE };
+    static Boolean s_FileOpened = TE_FALSE;
+    static Boolean s_TeardownRegistered = TE_FALSE;
+    static LogSpecification s_Specification{};
+    static LogMode s_Mode = LogMode::Synchronous;
     static std::shared_ptr<spdlog::logger> s_CoreLogger = nullptr;
     static std::shared_ptr<spdlog::logger> s_ClientLogger = nullptr;
 
-    void LogSystem::Init()
+    static const UInt32 LOG_FLUSH_TIMEOUT_MS = 2000;
+
+    // Only sees flushes posted by LogSystem::Flush. The single worker runs the queue in order, so
+    // once it reaches this sink every message queued before the request has been written.
+    class LogFlushBarrierSink final : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+    {
+        public:
+            UInt64 Post()
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                return ++m_Requested;
+            }
+
+            Boolean Wait(UInt64 ticket)
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                return m_Completed.wait_for(lock, std::chrono::milliseconds(LOG_FLUSH_TIMEOUT_MS), [&]() { return m_Reached >= ticket; });
+            }
+
+        protected:
+            void sink_it_(const spdlog::details::log_msg&) override {}
+
+            void flush_() override
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_Reached++;
+                }
+                m_Completed.notify_all();
+            }
+
+        private:
+            std::mutex m_Mutex;
+            std::condition_variable m_Completed;
+            UInt64 m_Requested{ TE_NULL };
+            UInt64 m_Reached{ TE_NULL };
+    };
+
+    static Ref<LogFlushBarrierSink> s_FlushBarrier = nullptr;
+    static std::shared_ptr<spdlog::logger> s_FlushBarrierLogger = nullptr;
+    static std::atomic<std::thread::id> s_LogWorkerThread{};
+
+    static Ref<spdlog::logger> CreateLogger(const String& name, const std::vector<spdlog::sink_ptr>& sinks, const LogSpecification& specification)
+    {
+        Ref<spdlog::logger> logger{ nullptr };
+        if(specification.Mode == LogMode::Asynchronous)
+        {
+            spdlog::async_overflow_policy policy = (specification.Overflow == LogOverflowPolicy::DropOldest) ? spdlog::async_overflow_policy::overrun_oldest : spdlog::async_overflow_policy::block;
+            logger = std::make_shared<spdlog::async_logger>(name, std::begin(sinks), std::end(sinks), spdlog::thread_pool(), policy);
+        }
+        else
+        {
+            logger = std::make_shared<spdlog::logger>(name, std::begin(sinks), std::end(sinks));
+        }
+
+        spdlog::register_logger(logger);
+        logger->set_level(static_cast<spdlog::level::level_enum>(TE_LOG_ACTIVE_LEVEL));
+        logger->flush_on(spdlog::level::err);
+        return logger;
+    }
+
+    static void ShutdownLocked()
+    {
+        if(!s_Initialized.load())
+            return;
+
+        if(s_Mode == LogMode::Asynchronous && spdlog::thread_pool()->overrun_counter())
+            s_CoreLogger->warn("Log queue overflowed, {0} messages were dropped", spdlog::thread_pool()->overrun_counter());
+
+        s_Initialized.store(TE_FALSE);
+        s_FlushBarrierLogger = nullptr;
+        s_FlushBarrier = nullptr;
+        spdlog::shutdown();
+        s_CoreLogger = nullptr;
+        s_ClientLogger = nullptr;
+        s_LogWorkerThread.store(std::thread::id());
+    }
+
+    // Both loggers share one queue and one worker thread, so messages keep their order in the file.
+    // The worker does the pattern formatting and the writes; callers only format the message and
+    // enqueue it. Everything below error is flushed every FlushIntervalSeconds instead of per line.
+    static void InitLocked(const LogSpecification& specification)
     {
+        ShutdownLocked();
+
         std::vector<spdlog::sink_ptr> log_skin{};
         log_skin.emplace_back(CreateRef<spdlog::sinks::stdout_color_sink_mt>());
-        log_skin.emplace_back(CreateRef<spdlog::sinks::basic_file_sink_mt>("TE.log", true));
+        log_skin.emplace_back(CreateRef<spdlog::sinks::basic_file_sink_mt>(specification.FilePath.string(), !s_FileOpened));
         log_skin[0]->set_pattern("%^[%T] %n: %v%$");
         log_skin[1]->set_pattern("[%T][%l] %n: %v");
 
-        s_CoreLogger = std::make_shared<spdlog::logger>("TE:Core", std::begin(log_skin), std::end(log_skin));
-        spdlog::register_logger(s_CoreLogger);
-        s_CoreLogger->set_level(spdlog::level::trace);
-        s_CoreLogger->flush_on(spdlog::level::trace);
+        if(specification.Mode == LogMode::Asynchronous)
+            spdlog::init_thread_pool(specification.QueueSize, 1, []() { s_LogWorkerThread.store(std::this_thread::get_id()); });
+
+        s_Mode = specification.Mode;
+        s_CoreLogger = CreateLogger("TE:Core", log_skin, specification);
+        s_ClientLogger = CreateLogger("TE:Client", log_skin, specification);
+
+        // Kept out of the registry so the periodic flush does not advance the barrier.
+        if(specification.Mode == LogMode::Asynchronous)
+        {
+            s_FlushBarrier = CreateRef<LogFlushBarrierSink>();
+            s_FlushBarrierLogger = std::make_shared<spdlog::async_logger>("TE:FlushBarrier", s_FlushBarrier, spdlog::thread_pool(), spdlog::async_overflow_policy::block);
+        }
+
+        if(specification.FlushIntervalSeconds)
+            spdlog::flush_every(std::chrono::seconds(specification.FlushIntervalSeconds));
+
+        s_FileOpened = TE_TRUE;
+        s_Initialized.store(TE_TRUE);
+    }
+
+    void LogSystem::Init(const LogSpecification& specification)
+    {
+        std::lock_guard<std::mutex> lock(s_StateMutex);
+        s_Specification = specification;
+        InitLocked(specification);
+    }
+
+    // The loggers are released here, so the caller that ran Init shuts down only after every thread
+    // that may still log has been joined.
+    void LogSystem::Shutdown()
+    {
+        std::lock_guard<std::mutex> lock(s_StateMutex);
+        ShutdownLocked();
+    }
+
+    // Used before breaking into the debugger, when queued messages would otherwise be lost. Queues a
+    // flush of the shared sinks followed by a barrier and waits until the worker has passed both. On
+    // the worker itself, or in synchronous mode, the sinks are flushed directly.
+    void LogSystem::Flush()
+    {
+        if(!s_Initialized.load())
+            return;
+
+        if(s_Mode == LogMode::Synchronous || s_LogWorkerThread.load() == std::this_thread::get_id())
+        {
+            for(auto& sink : s_CoreLogger->sinks())
+                sink->flush();
+
+            return;
+        }
+
+        UInt64 ticket = s_FlushBarrier->Post();
+        s_CoreLogger->flush();
+        s_FlushBarrierLogger->flush();
+        if(!s_FlushBarrier->Wait(ticket))
+            std::fprintf(stderr, "LogSystem::Flush timed out waiting for the logging thread\n");
+    }
+
+    // Logging before Init, or after Shutdown, creates the loggers from the last specification given to
+    // Init. The log file is truncated only by the first Init of the process; after a Shutdown the
+    // loggers come back synchronously and append, so late teardown messages neither wipe the session
+    // nor start a worker thread. Loggers nobody initialized explicitly are shut down at exit.
+    static void LazyInit()
+    {
+        std::lock_guard<std::mutex> lock(s_StateMutex);
+        if(s_Initialized.load())
+            return;
+
+        LogSpecification specification = s_Specification;
+        if(s_FileOpened)
+            specification.Mode = LogMode::Synchronous;
 
-        s_ClientLogger = std::make_shared<spdlog::logger>("TE:Client", std::begin(log_skin), std::end(log_skin));
-        spdlog::register_logger(s_ClientLogger);
-        s_ClientLogger->set_level(spdlog::level::trace);
-        s_ClientLogger->flush_on(spdlog::level::trace);
-        s_Initialized = true;
+        InitLocked(specification);
+        if(!s_TeardownRegistered)
+        {
+            std::atexit([]() { LogSystem::Shutdown(); });
+            s_TeardownRegistered = TE_TRUE;
+        }
     }
 
     std::shared_ptr<spdlog::logger>& LogSystem::GetCoreLogger() 
     {
-        if(!s_Initialized)
-            Init();
+        if(!s_Initialized.load())
+            LazyInit();
 
         return s_CoreLogger;
     }
 
     std::shared_ptr<spdlog::logger>& LogSystem::GetClientLogger() 
     {
-        if(!s_Initialized)
-            Init();
+        if(!s_Initialized.load())
+            LazyInit();
 
         return s_ClientLogger;
     }
-}
\ No newline at end of file
+}
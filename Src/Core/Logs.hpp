@@ -9,25 +9,78 @@
 
 #include "TypeDef.hpp"
 
+// Calls below TE_LOG_ACTIVE_LEVEL compile to nothing, arguments included. Release builds strip trace
+// and debug; define TE_LOG_ACTIVE_LEVEL to override.
+#define TE_LOG_LEVEL_TRACE      0
+#define TE_LOG_LEVEL_DEBUG      1
+#define TE_LOG_LEVEL_INFO       2
+
+#ifndef TE_LOG_ACTIVE_LEVEL
+    #ifdef TRIMANA_DEBUG
+        #define TE_LOG_ACTIVE_LEVEL TE_LOG_LEVEL_TRACE
+    #else
+        #define TE_LOG_ACTIVE_LEVEL TE_LOG_LEVEL_INFO
+    #endif
+#endif
+
 namespace TE::Core
 {
+    enum class LogMode
+    {
+        Synchronous     = 0,
+        Asynchronous    = 1
+    };
+
+    enum class LogOverflowPolicy
+    {
+        Block           = 0,    // callers wait for the logging thread when the queue is full
+        DropOldest      = 1     // the oldest queued message is overwritten instead
+    };
+
+    struct LogSpecification
+    {
+        LogMode Mode{ LogMode::Asynchronous };
+        UInt32 QueueSize{ 8192 };                               // messages, allocated up front
+        LogOverflowPolicy Overflow{ LogOverflowPolicy::Block };
+        UInt32 FlushIntervalSeconds{ 1 };                       // errors and above flush immediately
+        Path FilePath{ "TE.log" };
+    };
+
+    // Init and Shutdown are paired by their caller; Shutdown must run after every thread that logs has
+    // been joined. Logging without an Init creates the loggers on first use and tears them down at exit.
     class LogSystem
     {
         public:
-            static void Init();
+            static void Init(const LogSpecification& specification = LogSpecification());
+            static void Shutdown();
+            static void Flush();
             static Ref<spdlog::logger>& GetCoreLogger();
             static Ref<spdlog::logger>& GetClientLogger();
     };
 
 }
 
-#define TE_CORE_TRACE(...)    ::TE::Core::LogSystem::GetCoreLogger()->trace(__VA_ARGS__)
+#if TE_LOG_ACTIVE_LEVEL <= TE_LOG_LEVEL_TRACE
+    #define TE_CORE_TRACE(...)    ::TE::Core::LogSystem::GetCoreLogger()->trace(__VA_ARGS__)
+    #define TE_TRACE(...)         ::TE::Core::LogSystem::GetClientLogger()->trace(__VA_ARGS__)
+#else
+    #define TE_CORE_TRACE(...)    (void)0
+    #define TE_TRACE(...)         (void)0
+#endif
+
+#if TE_LOG_ACTIVE_LEVEL <= TE_LOG_LEVEL_DEBUG
+    #define TE_CORE_DEBUG(...)    ::TE::Core::LogSystem::GetCoreLogger()->debug(__VA_ARGS__)
+    #define TE_DEBUG(...)         ::TE::Core::LogSystem::GetClientLogger()->debug(__VA_ARGS__)
+#else
+    #define TE_CORE_DEBUG(...)    (void)0
+    #define TE_DEBUG(...)         (void)0
+#endif
+
 #define TE_CORE_INFO(...)     ::TE::Core::LogSystem::GetCoreLogger()->info(__VA_ARGS__)
 #define TE_CORE_WARN(...)     ::TE::Core::LogSystem::GetCoreLogger()->warn(__VA_ARGS__)
 #define TE_CORE_ERROR(...)    ::TE::Core::LogSystem::GetCoreLogger()->error(__VA_ARGS__)
 #define TE_CORE_CRITICAL(...) ::TE::Core::LogSystem::GetCoreLogger()->critical(__VA_ARGS__)
 
-#define TE_TRACE(...)    ::TE::Core::LogSystem::GetClientLogger()->trace(__VA_ARGS__)
 #define TE_INFO(...)     ::TE::Core::LogSystem::GetClientLogger()->info(__VA_ARGS__)
 #define TE_WARN(...)     ::TE::Core::LogSystem::GetClientLogger()->warn(__VA_ARGS__)
 #define TE_ERROR(...)    ::TE::Core::LogSystem::GetClientLogger()->error(__VA_ARGS__)
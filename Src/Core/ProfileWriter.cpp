@@ -0,0 +1,464 @@
+#include <bit>
+#include <charconv>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ProfileWriter.hpp"
+
+namespace TE::Core
+{
+    // JSON strings may not hold raw control characters, so those go out as \u00XX escapes.
+    static void AppendEscaped(String& output, std::string_view text)
+    {
+        static constexpr char hex[] = "0123456789abcdef";
+        for(char c : text)
+        {
+            const UInt8 byte = static_cast<UInt8>(c);
+            if(byte < 0x20)
+            {
+                output.append("\\u00");
+                output.push_back(hex[byte >> 4]);
+                output.push_back(hex[byte & 0x0F]);
+                continue;
+            }
+
+            if(c == '"' || c == '\\')
+                output.push_back('\\');
+            output.push_back(c);
+        }
+    }
+
+    template<typename T>
+    static void AppendNumber(String& output, T value)
+    {
+        char digits[32];
+        output.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+    }
+
+    // Trace timestamps are microseconds; writing the nanosecond remainder as three fixed digits keeps
+    // full precision without going through floating point formatting.
+    static void AppendMicroseconds(String& output, UInt64 nanoseconds)
+    {
+        AppendNumber(output, nanoseconds / 1000);
+        UInt64 fraction = nanoseconds % 1000;
+        output.push_back('.');
+        output.push_back(static_cast<char>('0' + fraction / 100));
+        output.push_back(static_cast<char>('0' + fraction / 10 % 10));
+        output.push_back(static_cast<char>('0' + fraction % 10));
+    }
+
+    // Chrome's trace_event JSON. Events are streamed as they drain; only the closing bracket is
+    // written at the end, so a crashed session still loads after appending "]}".
+    class ChromeTraceWriter : public ProfileWriter
+    {
+        public:
+            ChromeTraceWriter(std::ofstream& stream, const String& sessionName, UInt64 sessionStart)
+                : m_Stream(stream), m_SessionStart(sessionStart)
+            {
+                m_Output += "{\"otherData\":{},\"traceEvents\":[";
+                m_Output += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":";
+                AppendNumber(m_Output, PROFILE_PROCESS_ID);
+                m_Output += ",\"args\":{\"name\":\"";
+                AppendEscaped(m_Output, sessionName);
+                m_Output += "\"}}";
+                WriteThread(PROFILE_GPU_THREAD_ID, "GPU");
+            }
+
+            void WriteThread(UInt32 threadID, const String& name) override
+            {
+                BeginEvent("thread_name", "M", threadID);
+                m_Output += ",\"args\":{\"name\":\"";
+                AppendEscaped(m_Output, name);
+                m_Output += "\"}}";
+            }
+
+            void WriteEvent(const ProfileEvent& event, UInt32 threadID) override
+            {
+                switch(event.Type)
+                {
+                    case ProfileEventType::Scope:
+                    case ProfileEventType::GPUScope:
+                    {
+                        BeginEvent(event.Name, "X", (event.Type == ProfileEventType::GPUScope) ? PROFILE_GPU_THREAD_ID : threadID);
+                        AppendTimestamp(event.Start);
+                        m_Output += ",\"dur\":";
+                        AppendMicroseconds(m_Output, event.End - event.Start);
+                        break;
+                    }
+                    case ProfileEventType::Frame:
+                    {
+                        BeginEvent(event.Name, "i", threadID);
+                        AppendTimestamp(event.Start);
+                        m_Output += ",\"s\":\"g\"";
+                        break;
+                    }
+                    case ProfileEventType::Counter:
+                    {
+                        BeginEvent(event.Name, "C", threadID);
+                        AppendTimestamp(event.Start);
+                        m_Output += ",\"args\":{\"value\":";
+                        AppendNumber(m_Output, std::bit_cast<Double>(event.End));
+                        m_Output.push_back('}');
+                        break;
+                    }
+                    case ProfileEventType::FlowBegin:
+                    case ProfileEventType::FlowEnd:
+                    case ProfileEventType::GPUFlowEnd:
+                    {
+                        Boolean begin = event.Type == ProfileEventType::FlowBegin;
+                        BeginEvent(event.Name, begin ? "s" : "f", (event.Type == ProfileEventType::GPUFlowEnd) ? PROFILE_GPU_THREAD_ID : threadID);
+                        AppendTimestamp(event.Start);
+                        m_Output += begin ? ",\"cat\":\"flow\",\"id\":" : ",\"cat\":\"flow\",\"bp\":\"e\",\"id\":";
+                        AppendNumber(m_Output, event.End);
+                        break;
+                    }
+                }
+
+                m_Output.push_back('}');
+            }
+
+            void Flush() override
+            {
+                m_Stream << m_Output;
+                m_Output.clear();
+            }
+
+            void Close(UInt64 endTime) override
+            {
+                (void)endTime;
+                m_Output += "]}";
+                Flush();
+            }
+
+        private:
+            void BeginEvent(std::string_view name, CString phase, UInt32 threadID)
+            {
+                m_Output += ",{\"name\":\"";
+                AppendEscaped(m_Output, name);
+                m_Output += "\",\"ph\":\"";
+                m_Output += phase;
+                m_Output += "\",\"pid\":";
+                AppendNumber(m_Output, PROFILE_PROCESS_ID);
+                m_Output += ",\"tid\":";
+                AppendNumber(m_Output, threadID);
+            }
+
+            void AppendTimestamp(UInt64 timestamp)
+            {
+                m_Output += ",\"ts\":";
+                AppendMicroseconds(m_Output, timestamp - m_SessionStart);
+            }
+
+        private:
+            std::ofstream& m_Stream;
+            String m_Output;
+            UInt64 m_SessionStart{ TE_NULL };
+    };
+
+    // Field numbers from perfetto/protos/perfetto/trace/trace_packet.proto and track_event/*.proto.
+    namespace PerfettoField
+    {
+        static const UInt32 TracePacket                 = 1;    // Trace.packet
+
+        static const UInt32 Timestamp                   = 8;    // TracePacket
+        static const UInt32 TrustedSequenceID           = 10;
+        static const UInt32 TrackEvent                  = 11;
+        static const UInt32 InternedData                = 12;
+        static const UInt32 SequenceFlags               = 13;
+        static const UInt32 TrackDescriptor             = 60;
+
+        static const UInt32 EventNames                  = 2;    // InternedData
+        static const UInt32 InternedIID                 = 1;    // EventName
+        static const UInt32 InternedName                = 2;
+
+        static const UInt32 EventType                   = 9;    // TrackEvent
+        static const UInt32 EventNameIID                = 10;
+        static const UInt32 EventTrackUUID              = 11;
+        static const UInt32 EventDoubleCounterValue     = 44;
+        static const UInt32 EventFlowIDs                = 47;
+        static const UInt32 EventTerminatingFlowIDs     = 48;
+
+        static const UInt32 TrackUUID                   = 1;    // TrackDescriptor
+        static const UInt32 TrackName                   = 2;
+        static const UInt32 TrackProcess                = 3;
+        static const UInt32 TrackThread                 = 4;
+        static const UInt32 TrackParentUUID             = 5;
+        static const UInt32 TrackCounter                = 8;
+
+        static const UInt32 ProcessPID                  = 1;    // ProcessDescriptor
+        static const UInt32 ProcessName                 = 6;
+        static const UInt32 ThreadPID                   = 1;    // ThreadDescriptor
+        static const UInt32 ThreadTID                   = 2;
+        static const UInt32 ThreadName                  = 5;
+    }
+
+    static const UInt32 PERFETTO_SEQUENCE_ID                = 1;
+    static const UInt32 PERFETTO_INCREMENTAL_STATE_CLEARED  = 1;
+    static const UInt32 PERFETTO_NEEDS_INCREMENTAL_STATE    = 2;
+    static const UInt32 PERFETTO_SLICE_BEGIN                = 1;
+    static const UInt32 PERFETTO_SLICE_END                  = 2;
+    static const UInt32 PERFETTO_INSTANT                    = 3;
+    static const UInt32 PERFETTO_COUNTER                    = 4;
+
+    static const UInt64 PERFETTO_PROCESS_TRACK              = 1;
+    static const UInt64 PERFETTO_FRAME_TRACK                = 2;
+    static const UInt64 PERFETTO_THREAD_TRACK_BASE          = 1ull << 32;
+    static const UInt64 PERFETTO_COUNTER_TRACK_BASE         = 1ull << 48;
+
+    class ProtobufMessage
+    {
+        public:
+            void Varint(UInt32 field, UInt64 value)
+            {
+                Tag(field, 0);
+                WriteVarint(value);
+            }
+
+            void Fixed64(UInt32 field, UInt64 value)
+            {
+                Tag(field, 1);
+                for(UInt32 i = 0; i < 8; i++)
+                    m_Bytes.push_back(static_cast<char>(value >> (i * 8)));
+            }
+
+            void Bytes(UInt32 field, std::string_view value)
+            {
+                Tag(field, 2);
+                WriteVarint(value.size());
+                m_Bytes.append(value);
+            }
+
+            void Message(UInt32 field, const ProtobufMessage& message)
+            {
+                Bytes(field, message.m_Bytes);
+            }
+
+            const String& GetBytes() const { return m_Bytes; }
+
+        private:
+            void Tag(UInt32 field, UInt32 wireType)
+            {
+                WriteVarint((static_cast<UInt64>(field) << 3) | wireType);
+            }
+
+            void WriteVarint(UInt64 value)
+            {
+                while(value >= 0x80)
+                {
+                    m_Bytes.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                    value >>= 7;
+                }
+                m_Bytes.push_back(static_cast<char>(value));
+            }
+
+        private:
+            String m_Bytes;
+    };
+
+    // A Perfetto trace is a stream of length-delimited TracePacket messages, so each packet can be
+    // written as soon as it is built and the file never needs a closing pass. Event names are
+    // interned per pointer, threads and counters get their own tracks, and frames become slices on
+    // a dedicated "Frames" track that runs from one marker to the next.
+    class PerfettoTraceWriter : public ProfileWriter
+    {
+        public:
+            PerfettoTraceWriter(std::ofstream& stream, const String& sessionName, UInt64 sessionStart)
+                : m_Stream(stream)
+            {
+                ProtobufMessage process;
+                process.Varint(PerfettoField::ProcessPID, PROFILE_PROCESS_ID);
+                process.Bytes(PerfettoField::ProcessName, sessionName);
+
+                ProtobufMessage process_track;
+                process_track.Varint(PerfettoField::TrackUUID, PERFETTO_PROCESS_TRACK);
+                process_track.Message(PerfettoField::TrackProcess, process);
+
+                ProtobufMessage packet;
+                packet.Varint(PerfettoField::Timestamp, sessionStart);
+                packet.Varint(PerfettoField::TrustedSequenceID, PERFETTO_SEQUENCE_ID);
+                packet.Varint(PerfettoField::SequenceFlags, PERFETTO_INCREMENTAL_STATE_CLEARED);
+                packet.Message(PerfettoField::TrackDescriptor, process_track);
+                WritePacket(packet);
+
+                ProtobufMessage frame_track;
+                frame_track.Varint(PerfettoField::TrackUUID, PERFETTO_FRAME_TRACK);
+                frame_track.Varint(PerfettoField::TrackParentUUID, PERFETTO_PROCESS_TRACK);
+                frame_track.Bytes(PerfettoField::TrackName, "Frames");
+                WriteDescriptor(frame_track);
+
+                ProtobufMessage gpu_track;
+                gpu_track.Varint(PerfettoField::TrackUUID, PERFETTO_THREAD_TRACK_BASE + PROFILE_GPU_THREAD_ID);
+                gpu_track.Varint(PerfettoField::TrackParentUUID, PERFETTO_PROCESS_TRACK);
+                gpu_track.Bytes(PerfettoField::TrackName, "GPU");
+                WriteDescriptor(gpu_track);
+            }
+
+            void WriteThread(UInt32 threadID, const String& name) override
+            {
+                ProtobufMessage thread;
+                thread.Varint(PerfettoField::ThreadPID, PROFILE_PROCESS_ID);
+                thread.Varint(PerfettoField::ThreadTID, threadID);
+                if(!name.empty())
+                    thread.Bytes(PerfettoField::ThreadName, name);
+
+                ProtobufMessage track;
+                track.Varint(PerfettoField::TrackUUID, PERFETTO_THREAD_TRACK_BASE + threadID);
+                track.Varint(PerfettoField::TrackParentUUID, PERFETTO_PROCESS_TRACK);
+                track.Message(PerfettoField::TrackThread, thread);
+                WriteDescriptor(track);
+            }
+
+            void WriteEvent(const ProfileEvent& event, UInt32 threadID) override
+            {
+                UInt64 thread_track = PERFETTO_THREAD_TRACK_BASE + threadID;
+                if(event.Type == ProfileEventType::GPUScope || event.Type == ProfileEventType::GPUFlowEnd)
+                    thread_track = PERFETTO_THREAD_TRACK_BASE + PROFILE_GPU_THREAD_ID;
+
+                switch(event.Type)
+                {
+                    case ProfileEventType::Scope:
+                    case ProfileEventType::GPUScope:
+                    {
+                        WriteTrackEvent(event.Start, thread_track, PERFETTO_SLICE_BEGIN, event.Name);
+                        WriteTrackEvent(event.End, thread_track, PERFETTO_SLICE_END, nullptr);
+                        break;
+                    }
+                    case ProfileEventType::Frame:
+                    {
+                        if(m_FrameOpen)
+                            WriteTrackEvent(event.Start, PERFETTO_FRAME_TRACK, PERFETTO_SLICE_END, nullptr);
+
+                        WriteTrackEvent(event.Start, PERFETTO_FRAME_TRACK, PERFETTO_SLICE_BEGIN, event.Name);
+                        m_FrameOpen = TE_TRUE;
+                        break;
+                    }
+                    case ProfileEventType::Counter:
+                    {
+                        ProtobufMessage track_event;
+                        track_event.Varint(PerfettoField::EventType, PERFETTO_COUNTER);
+                        track_event.Varint(PerfettoField::EventTrackUUID, GetCounterTrack(event.Name));
+                        track_event.Fixed64(PerfettoField::EventDoubleCounterValue, event.End);
+                        WriteEventPacket(event.Start, track_event, nullptr);
+                        break;
+                    }
+                    case ProfileEventType::FlowBegin:
+                    case ProfileEventType::FlowEnd:
+                    case ProfileEventType::GPUFlowEnd:
+                    {
+                        ProtobufMessage track_event;
+                        track_event.Varint(PerfettoField::EventType, PERFETTO_INSTANT);
+                        track_event.Varint(PerfettoField::EventTrackUUID, thread_track);
+                        track_event.Fixed64(event.Type == ProfileEventType::FlowBegin ? PerfettoField::EventFlowIDs : PerfettoField::EventTerminatingFlowIDs, event.End);
+                        WriteEventPacket(event.Start, track_event, event.Name);
+                        break;
+                    }
+                }
+            }
+
+            void Flush() override
+            {
+                m_Stream << m_Output;
+                m_Output.clear();
+            }
+
+            void Close(UInt64 endTime) override
+            {
+                if(m_FrameOpen)
+                    WriteTrackEvent(endTime, PERFETTO_FRAME_TRACK, PERFETTO_SLICE_END, nullptr);
+
+                m_FrameOpen = TE_FALSE;
+                Flush();
+            }
+
+        private:
+            void WritePacket(const ProtobufMessage& packet)
+            {
+                ProtobufMessage trace;
+                trace.Message(PerfettoField::TracePacket, packet);
+                m_Output += trace.GetBytes();
+            }
+
+            void WriteDescriptor(const ProtobufMessage& track)
+            {
+                ProtobufMessage packet;
+                packet.Varint(PerfettoField::TrustedSequenceID, PERFETTO_SEQUENCE_ID);
+                packet.Message(PerfettoField::TrackDescriptor, track);
+                WritePacket(packet);
+            }
+
+            void WriteTrackEvent(UInt64 timestamp, UInt64 track, UInt32 type, CString name)
+            {
+                ProtobufMessage track_event;
+                track_event.Varint(PerfettoField::EventType, type);
+                track_event.Varint(PerfettoField::EventTrackUUID, track);
+                WriteEventPacket(timestamp, track_event, name);
+            }
+
+            // Names travel once per session as interned data; every later event refers to the iid.
+            void WriteEventPacket(UInt64 timestamp, ProtobufMessage& trackEvent, CString name)
+            {
+                ProtobufMessage packet;
+                packet.Varint(PerfettoField::Timestamp, timestamp);
+                packet.Varint(PerfettoField::TrustedSequenceID, PERFETTO_SEQUENCE_ID);
+                packet.Varint(PerfettoField::SequenceFlags, PERFETTO_NEEDS_INCREMENTAL_STATE);
+
+                if(name)
+                {
+                    auto [it, inserted] = m_NameIDs.try_emplace(name, m_NameIDs.size() + 1);
+                    if(inserted)
+                    {
+                        ProtobufMessage event_name;
+                        event_name.Varint(PerfettoField::InternedIID, it->second);
+                        event_name.Bytes(PerfettoField::InternedName, name);
+
+                        ProtobufMessage interned;
+                        interned.Message(PerfettoField::EventNames, event_name);
+                        packet.Message(PerfettoField::InternedData, interned);
+                    }
+
+                    trackEvent.Varint(PerfettoField::EventNameIID, it->second);
+                }
+
+                packet.Message(PerfettoField::TrackEvent, trackEvent);
+                WritePacket(packet);
+            }
+
+            UInt64 GetCounterTrack(CString name)
+            {
+                UInt64 uuid = PERFETTO_COUNTER_TRACK_BASE + (std::hash<std::string_view>{}(name) & 0xFFFFFFFFFFFFull);
+                if(m_CounterTracks.insert(uuid).second)
+                {
+                    ProtobufMessage track;
+                    track.Varint(PerfettoField::TrackUUID, uuid);
+                    track.Varint(PerfettoField::TrackParentUUID, PERFETTO_PROCESS_TRACK);
+                    track.Bytes(PerfettoField::TrackName, name);
+                    track.Message(PerfettoField::TrackCounter, ProtobufMessage{});
+                    WriteDescriptor(track);
+                }
+
+                return uuid;
+            }
+
+        private:
+            std::ofstream& m_Stream;
+            String m_Output;
+            std::unordered_map<CString, UInt64> m_NameIDs;
+            std::unordered_set<UInt64> m_CounterTracks;
+            Boolean m_FrameOpen{ TE_FALSE };
+    };
+
+    ProfileFormat GetProfileFormat(const Path& filepath)
+    {
+        return (filepath.extension() == ".json") ? ProfileFormat::ChromeJSON : ProfileFormat::Perfetto;
+    }
+
+    Scope<ProfileWriter> CreateProfileWriter(ProfileFormat format, std::ofstream& stream, const String& sessionName, UInt64 sessionStart)
+    {
+        switch(format)
+        {
+            case ProfileFormat::ChromeJSON:     return CreateScope<ChromeTraceWriter>(stream, sessionName, sessionStart);
+            case ProfileFormat::Perfetto:       return CreateScope<PerfettoTraceWriter>(stream, sessionName, sessionStart);
+            default:                            return nullptr;
+        }
+    }
+}
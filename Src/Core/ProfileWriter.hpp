@@ -0,0 +1,31 @@
+#pragma once
+
+#include "TypeDef.hpp"
+#include "Profiler.hpp"
+
+namespace TE::Core
+{
+    static const UInt32 PROFILE_PROCESS_ID = 1;
+
+    enum class ProfileFormat
+    {
+        ChromeJSON  = 0,
+        Perfetto    = 1
+    };
+
+    // Serializes drained events into a stream. Writers only append to an in-memory chunk; Flush()
+    // hands the chunk to the stream so the file grows steadily instead of being built at the end.
+    class ProfileWriter
+    {
+        public:
+            virtual ~ProfileWriter() = default;
+
+            virtual void WriteThread(UInt32 threadID, const String& name) = 0;
+            virtual void WriteEvent(const ProfileEvent& event, UInt32 threadID) = 0;
+            virtual void Flush() = 0;
+            virtual void Close(UInt64 endTime) = 0;
+    };
+
+    ProfileFormat GetProfileFormat(const Path& filepath);
+    Scope<ProfileWriter> CreateProfileWriter(ProfileFormat format, std::ofstream& stream, const String& sessionName, UInt64 sessionStart);
+}
@@ -0,0 +1,344 @@
+#include <bit>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <condition_variable>
+
+#if defined(TRIMANA_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #include <psapi.h>
+#elif defined(TRIMANA_PLATFORM_LINUX)
+    #include <unistd.h>
+#endif
+
+#include "Profiler.hpp"
+#include "ProfileWriter.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Core
+{
+    // What a drain copies out of a ring under BuffersMutex; the events themselves are read after the
+    // lock is released. A ring is only recycled once it is empty, so its events up to Head stay put.
+    struct ProfileDrainRange
+    {
+        ProfileThreadBuffer* Buffer{ nullptr };
+        UInt64 Head{ TE_NULL };
+        UInt32 ThreadID{ TE_NULL };
+        Boolean NameChanged{ TE_FALSE };
+        String ThreadName{};
+    };
+
+    struct ProfilerData
+    {
+        std::atomic<Boolean> Active{ TE_FALSE };
+        std::mutex BuffersMutex;
+        std::vector<Scope<ProfileThreadBuffer>> Buffers;
+        std::vector<ProfileDrainRange> DrainRanges;
+
+        std::thread WriterThread;
+        std::mutex WriterMutex;
+        std::condition_variable WriterWake;
+        Boolean Stopping{ TE_FALSE };
+
+        std::ofstream OutputStream;
+        Scope<ProfileWriter> Writer{ nullptr };
+        UInt64 SessionStart{ TE_NULL };
+        std::atomic<UInt32> NextThreadID{ 1 };
+        std::atomic<UInt64> NextFlowID{ 1 };
+
+    }; static ProfilerData s_ProfilerData;
+
+    // Returns the ring to its pool when the thread exits; the writer still drains whatever it left.
+    // The ring is only allocated by the first event the thread records, so naming a thread that never
+    // records while a session runs costs a string, not a ring.
+    struct ProfileThreadSlot
+    {
+        ProfileThreadBuffer* Buffer{ nullptr };
+        String PendingName{};
+
+        ~ProfileThreadSlot()
+        {
+            if(Buffer)
+                Buffer->Retired.store(TE_TRUE, std::memory_order_release);
+        }
+    };
+
+    static thread_local ProfileThreadSlot s_ThreadSlot;
+
+    static UInt64 ResidentMemoryBytes()
+    {
+        #if defined(TRIMANA_PLATFORM_WINDOWS)
+            PROCESS_MEMORY_COUNTERS counters{};
+            if(K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+                return counters.WorkingSetSize;
+            return TE_NULL;
+        #elif defined(TRIMANA_PLATFORM_LINUX)
+            UInt64 pages = TE_NULL;
+            UInt64 resident = TE_NULL;
+            std::FILE* statm = std::fopen("/proc/self/statm", "r");
+            if(!statm)
+                return TE_NULL;
+
+            Int32 read = std::fscanf(statm, "%llu %llu", &pages, &resident);
+            std::fclose(statm);
+            return (read == 2) ? resident * static_cast<UInt64>(sysconf(_SC_PAGESIZE)) : TE_NULL;
+        #else
+            return TE_NULL;
+        #endif
+    }
+
+    static ProfileThreadBuffer* AcquireThreadBuffer()
+    {
+        std::lock_guard<std::mutex> lock(s_ProfilerData.BuffersMutex);
+
+        ProfileThreadBuffer* buffer = nullptr;
+        for(auto& candidate : s_ProfilerData.Buffers)
+        {
+            if(candidate->Retired.load(std::memory_order_acquire) && candidate->Head.load(std::memory_order_relaxed) == candidate->Tail.load(std::memory_order_acquire))
+            {
+                buffer = candidate.get();
+                break;
+            }
+        }
+
+        if(!buffer)
+            buffer = s_ProfilerData.Buffers.emplace_back(CreateScope<ProfileThreadBuffer>()).get();
+
+        buffer->CachedTail = buffer->Tail.load(std::memory_order_relaxed);
+        buffer->ThreadID.store(s_ProfilerData.NextThreadID++, std::memory_order_relaxed);
+        buffer->Retired.store(TE_FALSE, std::memory_order_relaxed);
+        buffer->ThreadName = std::move(s_ThreadSlot.PendingName);
+        buffer->NameVersion++;
+        return buffer;
+    }
+
+    // Events left over from before the session, or recorded by a scope that straddled the previous
+    // EndSession(), are discarded by their timestamp. Resident memory is sampled here, once per drain
+    // that saw a frame marker, so the syscalls stay off the threads being profiled. Only the ranges are
+    // taken under BuffersMutex; serialising and flushing run unlocked so new threads never wait on I/O.
+    static void DrainBuffers()
+    {
+        ProfileEvent last_frame{};
+        UInt32 last_frame_thread = TE_NULL;
+
+        auto& ranges = s_ProfilerData.DrainRanges;
+        ranges.clear();
+        {
+            std::lock_guard<std::mutex> lock(s_ProfilerData.BuffersMutex);
+            for(auto& buffer : s_ProfilerData.Buffers)
+            {
+                ProfileDrainRange& range = ranges.emplace_back();
+                range.Buffer = buffer.get();
+                range.Head = buffer->Head.load(std::memory_order_acquire);
+                range.ThreadID = buffer->ThreadID.load(std::memory_order_relaxed);
+                if(range.ThreadID && (buffer->WrittenThreadID != range.ThreadID || buffer->WrittenNameVersion != buffer->NameVersion))
+                {
+                    range.NameChanged = TE_TRUE;
+                    range.ThreadName = buffer->ThreadName;
+                    buffer->WrittenThreadID = range.ThreadID;
+                    buffer->WrittenNameVersion = buffer->NameVersion;
+                }
+            }
+        }
+
+        for(const auto& range : ranges)
+        {
+            ProfileThreadBuffer* buffer = range.Buffer;
+            UInt64 tail = buffer->Tail.load(std::memory_order_relaxed);
+            if(range.NameChanged)
+                s_ProfilerData.Writer->WriteThread(range.ThreadID, range.ThreadName);
+
+            for(; tail != range.Head; tail++)
+            {
+                const ProfileEvent& event = buffer->Events[tail & (PROFILE_BUFFER_CAPACITY - 1)];
+                if(event.Start < s_ProfilerData.SessionStart)
+                    continue;
+
+                s_ProfilerData.Writer->WriteEvent(event, range.ThreadID);
+                if(event.Type == ProfileEventType::Frame && event.Start >= last_frame.Start)
+                {
+                    last_frame = event;
+                    last_frame_thread = range.ThreadID;
+                }
+            }
+
+            buffer->Tail.store(tail, std::memory_order_release);
+        }
+
+        if(last_frame_thread)
+        {
+            UInt64 resident = ResidentMemoryBytes();
+            if(resident)
+                s_ProfilerData.Writer->WriteEvent({ "Resident Memory (MB)", last_frame.Start, std::bit_cast<UInt64>(resident / (1024.0 * 1024.0)), ProfileEventType::Counter }, last_frame_thread);
+        }
+
+        s_ProfilerData.Writer->Flush();
+    }
+
+    static void RunWriter()
+    {
+        std::unique_lock<std::mutex> lock(s_ProfilerData.WriterMutex);
+        while(!s_ProfilerData.Stopping)
+        {
+            s_ProfilerData.WriterWake.wait_for(lock, std::chrono::milliseconds(PROFILE_DRAIN_INTERVAL_MS));
+            DrainBuffers();
+        }
+    }
+
+    void Profiler::BeginSession(const String& name, const Path& filepath)
+    {
+        if(s_ProfilerData.Active.load(std::memory_order_relaxed))
+        {
+            TE_CORE_WARN("Profiler session '{0}' started while another session is active", name);
+            EndSession();
+        }
+
+        // Perfetto traces are raw protobuf; text mode would expand 0x0A bytes on Windows.
+        s_ProfilerData.OutputStream.open(filepath, std::ios::out | std::ios::trunc | std::ios::binary);
+        if(!s_ProfilerData.OutputStream)
+        {
+            TE_CORE_ERROR("Failed to open profile output {0}", filepath.string());
+            return;
+        }
+
+        s_ProfilerData.SessionStart = Now();
+        s_ProfilerData.Writer = CreateProfileWriter(GetProfileFormat(filepath), s_ProfilerData.OutputStream, name, s_ProfilerData.SessionStart);
+        s_ProfilerData.Stopping = TE_FALSE;
+        {
+            std::lock_guard<std::mutex> lock(s_ProfilerData.BuffersMutex);
+            for(auto& buffer : s_ProfilerData.Buffers)
+            {
+                buffer->Dropped.store(TE_NULL, std::memory_order_relaxed);
+                buffer->WrittenThreadID = TE_NULL;
+            }
+        }
+
+        s_ProfilerData.WriterThread = std::thread(RunWriter);
+        s_ProfilerData.Active.store(TE_TRUE, std::memory_order_release);
+    }
+
+    void Profiler::EndSession()
+    {
+        if(!s_ProfilerData.Active.exchange(TE_FALSE, std::memory_order_acq_rel))
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(s_ProfilerData.WriterMutex);
+            s_ProfilerData.Stopping = TE_TRUE;
+        }
+
+        s_ProfilerData.WriterWake.notify_one();
+        s_ProfilerData.WriterThread.join();
+        DrainBuffers();
+
+        s_ProfilerData.Writer->Close(Now());
+        s_ProfilerData.Writer = nullptr;
+        s_ProfilerData.OutputStream.close();
+
+        UInt64 dropped = GetDroppedCount();
+        if(dropped > 0)
+            TE_CORE_WARN("Profiler dropped {0} events; a thread outran the writer", dropped);
+    }
+
+    Boolean Profiler::IsActive()
+    {
+        return s_ProfilerData.Active.load(std::memory_order_relaxed);
+    }
+
+    static ProfileThreadBuffer* GetThreadBuffer()
+    {
+        if(!s_ThreadSlot.Buffer)
+            s_ThreadSlot.Buffer = AcquireThreadBuffer();
+
+        return s_ThreadSlot.Buffer;
+    }
+
+    static void Push(const ProfileEvent& event)
+    {
+        ProfileThreadBuffer* buffer = GetThreadBuffer();
+
+        // Tail is only re-read when the cached copy says the ring is full, so the common push never
+        // touches the cache line the writer thread is updating.
+        UInt64 head = buffer->Head.load(std::memory_order_relaxed);
+        if(head - buffer->CachedTail >= PROFILE_BUFFER_CAPACITY)
+        {
+            buffer->CachedTail = buffer->Tail.load(std::memory_order_acquire);
+            if(head - buffer->CachedTail >= PROFILE_BUFFER_CAPACITY)
+            {
+                buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        buffer->Events[head & (PROFILE_BUFFER_CAPACITY - 1)] = event;
+        buffer->Head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::Record(CString name, UInt64 start, UInt64 end)
+    {
+        Push({ name, start, end, ProfileEventType::Scope });
+    }
+
+    UInt64 Profiler::GetDroppedCount()
+    {
+        std::lock_guard<std::mutex> lock(s_ProfilerData.BuffersMutex);
+
+        UInt64 dropped = TE_NULL;
+        for(auto& buffer : s_ProfilerData.Buffers)
+            dropped += buffer->Dropped.load(std::memory_order_relaxed);
+
+        return dropped;
+    }
+
+    void Profiler::SetThreadName(const String& name)
+    {
+        ProfileThreadBuffer* buffer = s_ThreadSlot.Buffer;
+        if(!buffer)
+        {
+            s_ThreadSlot.PendingName = name;
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(s_ProfilerData.BuffersMutex);
+        buffer->ThreadName = name;
+        buffer->NameVersion++;
+    }
+
+    void Profiler::MarkFrame()
+    {
+        if(IsActive())
+            Push({ "Frame", Now(), TE_NULL, ProfileEventType::Frame });
+    }
+
+    void Profiler::Counter(CString name, Double value)
+    {
+        if(IsActive())
+            Push({ name, Now(), std::bit_cast<UInt64>(value), ProfileEventType::Counter });
+    }
+
+    UInt64 Profiler::NewFlowID()
+    {
+        return s_ProfilerData.NextFlowID.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Profiler::FlowBegin(CString name, UInt64 id)
+    {
+        if(IsActive())
+            Push({ name, Now(), id, ProfileEventType::FlowBegin });
+    }
+
+    void Profiler::FlowEnd(CString name, UInt64 id)
+    {
+        if(IsActive())
+            Push({ name, Now(), id, ProfileEventType::FlowEnd });
+    }
+
+    void Profiler::RecordGPU(CString name, UInt64 start, UInt64 end, UInt64 flowID)
+    {
+        Push({ name, start, end, ProfileEventType::GPUScope });
+        if(flowID)
+            Push({ name, start, flowID, ProfileEventType::GPUFlowEnd });
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include "TypeDef.hpp"
+
+namespace TE::Core
+{
+    static const UInt32 PROFILE_BUFFER_CAPACITY     = 8192;     // events per thread, power of two
+    static const UInt32 PROFILE_DRAIN_INTERVAL_MS   = 2;
+    static const UInt32 PROFILE_GPU_THREAD_ID       = 0xFFFF;   // GPU intervals share one track
+
+    static_assert((PROFILE_BUFFER_CAPACITY & (PROFILE_BUFFER_CAPACITY - 1)) == 0, "Profile buffer capacity must be a power of two");
+
+    enum class ProfileEventType : UInt32
+    {
+        Scope       = 0,
+        Frame       = 1,
+        Counter     = 2,
+        FlowBegin   = 3,
+        FlowEnd     = 4,
+        GPUScope    = 5,
+        GPUFlowEnd  = 6
+    };
+
+    // Name must have static storage duration (a literal or __FUNCSIG__); only the pointer is recorded.
+    // End holds the scope end for scopes, the flow id for flows and the bits of the value for counters.
+    struct ProfileEvent
+    {
+        CString Name{ nullptr };
+        UInt64 Start{ TE_NULL };
+        UInt64 End{ TE_NULL };
+        ProfileEventType Type{ ProfileEventType::Scope };
+    };
+
+    // Single-producer/single-consumer ring owned by one thread at a time. The owning thread advances
+    // Head, the writer thread advances Tail; a full ring drops the event instead of waiting.
+    struct ProfileThreadBuffer
+    {
+        std::array<ProfileEvent, PROFILE_BUFFER_CAPACITY> Events{};
+        alignas(64) std::atomic<UInt64> Head{ TE_NULL };
+        UInt64 CachedTail{ TE_NULL };                           // producer's last view of Tail
+        alignas(64) std::atomic<UInt64> Tail{ TE_NULL };
+        std::atomic<UInt64> Dropped{ TE_NULL };
+        std::atomic<UInt32> ThreadID{ TE_NULL };
+        std::atomic<Boolean> Retired{ TE_FALSE };
+
+        String ThreadName{};                                    // guarded by the profiler's buffer lock
+        UInt32 NameVersion{ TE_NULL };
+        UInt32 WrittenThreadID{ TE_NULL };                      // writer thread only
+        UInt32 WrittenNameVersion{ TE_NULL };
+    };
+
+    // Records scopes from any thread into per-thread rings and serializes them from a background
+    // writer thread, so a finished scope costs two clock reads and one ring push. The output format
+    // follows the session file: ".json" streams Chrome trace JSON, anything else (".perfetto-trace",
+    // ".pftrace") streams Perfetto protobuf packets, which stay practical for multi-minute captures.
+    class Profiler
+    {
+        private:
+            Profiler() = default;
+            ~Profiler() = default;
+
+        public:
+            static void BeginSession(const String& name, const Path& filepath = "results.json");
+            static void EndSession();
+
+            static Boolean IsActive();
+            static void Record(CString name, UInt64 start, UInt64 end);
+            static UInt64 GetDroppedCount();
+
+            static void SetThreadName(const String& name);
+            static void MarkFrame();
+            static void Counter(CString name, Double value);
+            static UInt64 NewFlowID();
+            static void FlowBegin(CString name, UInt64 id);
+            static void FlowEnd(CString name, UInt64 id);
+            // Start and end are already on the steady clock; the flow, if any, ends where the interval starts.
+            static void RecordGPU(CString name, UInt64 start, UInt64 end, UInt64 flowID = TE_NULL);
+
+            static UInt64 Now()
+            {
+                return static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+    };
+
+    class ProfileScope
+    {
+        public:
+            explicit ProfileScope(CString name)
+                : m_Name(Profiler::IsActive() ? name : nullptr)
+            {
+                if(m_Name)
+                    m_Start = Profiler::Now();
+            }
+
+            ~ProfileScope()
+            {
+                if(m_Name)
+                    Profiler::Record(m_Name, m_Start, Profiler::Now());
+            }
+
+            ProfileScope(const ProfileScope&) = delete;
+            ProfileScope& operator=(const ProfileScope&) = delete;
+
+        private:
+            CString m_Name{ nullptr };
+            UInt64 m_Start{ TE_NULL };
+    };
+}
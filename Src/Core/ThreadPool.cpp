@@ -0,0 +1,75 @@
+#include "ThreadPool.hpp"
+#include "Instrument.hpp"
+
+namespace TE::Core
+{
+    ThreadPool::ThreadPool(UInt32 workerCount, const String& name)
+    {
+        if(workerCount == TE_NULL)
+        {
+            UInt32 hardware_threads = std::thread::hardware_concurrency();
+            workerCount = (hardware_threads > 1) ? hardware_threads - 1 : 1;
+        }
+
+        m_Workers.reserve(workerCount);
+        for(UInt32 i = 0; i < workerCount; i++)
+            m_Workers.emplace_back(&ThreadPool::Run, this, name + " " + std::to_string(i));
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stopping = TE_TRUE;
+        }
+
+        m_JobAvailable.notify_all();
+        for(auto& worker : m_Workers)
+            worker.join();
+    }
+
+    void ThreadPool::Submit(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.emplace_back(std::move(job));
+        }
+
+        m_JobAvailable.notify_one();
+    }
+
+    void ThreadPool::Wait()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Idle.wait(lock, [this]() { return m_Jobs.empty() && m_ActiveJobs == 0; });
+    }
+
+    void ThreadPool::Run(String name)
+    {
+        TE_PROFILE_THREAD(name);
+
+        while(TE_TRUE)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_JobAvailable.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+                if(m_Stopping && m_Jobs.empty())
+                    return;
+
+                job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+                m_ActiveJobs++;
+            }
+
+            job();
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_ActiveJobs--;
+                if(m_Jobs.empty() && m_ActiveJobs == 0)
+                    m_Idle.notify_all();
+            }
+        }
+    }
+}
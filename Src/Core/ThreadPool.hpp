@@ -0,0 +1,37 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "TypeDef.hpp"
+
+namespace TE::Core
+{
+    class ThreadPool
+    {
+        public:
+            explicit ThreadPool(UInt32 workerCount = TE_NULL, const String& name = "Worker");
+            ~ThreadPool();
+
+            void Submit(std::function<void()> job);
+            void Wait();
+
+            UInt32 GetWorkerCount() const { return static_cast<UInt32>(m_Workers.size()); }
+
+        private:
+            void Run(String name);
+
+        private:
+            std::vector<std::thread> m_Workers;
+            std::deque<std::function<void()>> m_Jobs;
+            std::mutex m_Mutex;
+            std::condition_variable m_JobAvailable;
+            std::condition_variable m_Idle;
+            UInt32 m_ActiveJobs{TE_NULL};
+            Boolean m_Stopping{TE_FALSE};
+    };
+}
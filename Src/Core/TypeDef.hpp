@@ -14,6 +14,9 @@
 
 typedef int                         Int32;         
 typedef unsigned int                UInt32;        
+typedef long long                   Int64;         
+typedef unsigned long long          UInt64;        
+typedef short                       Int16;         
 typedef unsigned short              UInt16;        
 typedef unsigned char               UInt8;         
 typedef char                        Int8;         
@@ -83,3 +86,6 @@ typedef unsigned int TextureID;
 typedef unsigned char* TextureData;
 typedef unsigned int FrameBufferID;
 typedef unsigned int FrameBufferAttachmentID;
+typedef unsigned int StorageBufferID;
+typedef unsigned int UniformBufferID;
+typedef unsigned int StagingBufferID;
@@ -28,6 +28,24 @@ namespace TE::Renderer
         }
     }
 
+    Ref<StreamVertexBuffer> CreateStreamVertexBuffer(UInt32 capacity)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:
+            {
+                if(!TE::APIs::OpenGL::GL_StreamVertexBuffer::IsSupported())
+                    return nullptr;
+
+                return CreateRef<TE::APIs::OpenGL::GL_StreamVertexBuffer>(capacity);
+            }
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                        return nullptr;
+        }
+    }
+
     Ref<IndexBuffer> CreateIndexBuffer(IndexBufferData data, UInt32 count)
     {
         switch(Renderer::GetAPI())
@@ -40,4 +58,58 @@ namespace TE::Renderer
         }
     }
 
+    Ref<StorageBuffer> CreateStorageBuffer(UInt32 size)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:       return CreateRef<TE::APIs::OpenGL::GL_StorageBuffer>(size);
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                        return nullptr;
+        }
+    }
+
+    Ref<StagingBuffer> CreateStagingBuffer(UInt64 capacity)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:
+            {
+                if(!TE::APIs::OpenGL::GL_StagingBuffer::IsSupported())
+                    return nullptr;
+
+                return CreateRef<TE::APIs::OpenGL::GL_StagingBuffer>(capacity);
+            }
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                        return nullptr;
+        }
+    }
+
+    Ref<UniformBuffer> CreateUniformBuffer(UInt32 size)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:       return CreateRef<TE::APIs::OpenGL::GL_UniformBuffer>(size);
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                        return nullptr;
+        }
+    }
+
+    UInt32 GetUniformBufferOffsetAlignment()
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return TE_NULL;
+            case RendererAPI::OpenGL:       return TE::APIs::OpenGL::GL_UniformBuffer::QueryOffsetAlignment();
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return TE_NULL;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return TE_NULL;
+            default:                        return TE_NULL;
+        }
+    }
+
 }
\ No newline at end of file
@@ -32,6 +32,39 @@ namespace TE::Renderer
         MAT4        = sizeof(Float) * 4 * 4,    
     };
 
+    enum class BufferDataType
+    {
+        Float       = 0,
+        Half        = 1,
+        Int8        = 2,
+        UInt8       = 3,
+        Int16       = 4,
+        UInt16      = 5,
+        Int32       = 6,
+        UInt32      = 7,
+    };
+
+    inline UInt32 BufferDataTypeSize(BufferDataType type)
+    {
+        switch(type)
+        {
+            case BufferDataType::Float:     return sizeof(Float);
+            case BufferDataType::Half:      return sizeof(UInt16);
+            case BufferDataType::Int8:      return sizeof(Int8);
+            case BufferDataType::UInt8:     return sizeof(UInt8);
+            case BufferDataType::Int16:     return sizeof(Int16);
+            case BufferDataType::UInt16:    return sizeof(UInt16);
+            case BufferDataType::Int32:     return sizeof(Int32);
+            case BufferDataType::UInt32:    return sizeof(UInt32);
+            default:                        return TE_NULL;
+        }
+    }
+
+    inline Boolean IsIntegerDataType(BufferDataType type)
+    {
+        return type != BufferDataType::Float && type != BufferDataType::Half;
+    }
+
     struct BufferElements 
     {
         Int32 Offset{TE_NULL};              
@@ -39,10 +72,16 @@ namespace TE::Renderer
         BufferStride Stride{};             
         Boolean Normalized{TE_FALSE};       
         BufferComponents Components{};     
+        UInt32 Divisor{TE_NULL};
+        BufferDataType Type{BufferDataType::Float};
 
 
         BufferElements() = default;
-        BufferElements(const String& name, BufferComponents components, BufferStride stride, Boolean normalized) : Name(name), Components(components), Stride(stride), Normalized(normalized) {}
+        BufferElements(const String& name, BufferComponents components, BufferStride stride, Boolean normalized, UInt32 divisor = TE_NULL) : Name(name), Components(components), Stride(stride), Normalized(normalized), Divisor(divisor) {}
+
+        // Integer types that are not normalized reach the shader as int/uint attributes.
+        BufferElements(const String& name, BufferDataType type, BufferComponents components, Boolean normalized, UInt32 divisor = TE_NULL)
+            : Name(name), Components(components), Stride(static_cast<BufferStride>(BufferDataTypeSize(type) * static_cast<UInt32>(components))), Normalized(normalized), Divisor(divisor), Type(type) {}
         ~BufferElements() = default;
     };
 
@@ -91,11 +130,29 @@ namespace TE::Renderer
             virtual void Unbind() const = TE_NULL;
             virtual VertexBufferID GetID() const = TE_NULL;
 
-            virtual void SetData(const void* data, UInt32 size) = TE_NULL;
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) = TE_NULL;
             virtual void SetLayout(const BufferLayout& layout) = TE_NULL;
             virtual const BufferLayout& GetLayout() const = TE_NULL;
     };
 
+    // A persistently mapped ring sub-allocated by bytes. Reserve() hands out contiguous space at the
+    // write head, Release() advances the head by what was actually written, and Fence() marks the end
+    // of a frame so the ring only waits when it wraps onto data the GPU may still be reading.
+    // BindStorage() exposes the same ring to shaders that pull their vertices from storage.
+    class StreamVertexBuffer : public VertexBuffer
+    {
+        public:
+            StreamVertexBuffer() = default;
+            ~StreamVertexBuffer() = default;
+
+            virtual void* Reserve(UInt32 size) = TE_NULL;
+            virtual void Release(UInt32 size) = TE_NULL;
+            virtual void Fence() = TE_NULL;
+            virtual void BindStorage(UInt32 binding) const = TE_NULL;
+            virtual UInt32 GetReservedOffset() const = TE_NULL;
+            virtual UInt32 GetCapacity() const = TE_NULL;
+    };
+
     class IndexBuffer
     {
         public:
@@ -108,8 +165,58 @@ namespace TE::Renderer
             virtual UInt32 GetCount() const = TE_NULL;
     };
 
+    class StorageBuffer
+    {
+        public:
+            StorageBuffer() = default;
+            virtual ~StorageBuffer() = default;
+
+            virtual void Bind(UInt32 binding) const = TE_NULL;
+            virtual void Unbind(UInt32 binding) const = TE_NULL;
+            virtual StorageBufferID GetID() const = TE_NULL;
+            virtual UInt32 GetSize() const = TE_NULL;
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) = TE_NULL;
+    };
+
+    class UniformBuffer
+    {
+        public:
+            UniformBuffer() = default;
+            virtual ~UniformBuffer() = default;
+
+            virtual void Bind(UInt32 binding) const = TE_NULL;
+            virtual void BindRange(UInt32 binding, UInt32 offset, UInt32 size) const = TE_NULL;
+            virtual UniformBufferID GetID() const = TE_NULL;
+            virtual UInt32 GetSize() const = TE_NULL;
+            virtual UInt32 GetOffsetAlignment() const = TE_NULL;
+            virtual void SetData(const void* data, UInt32 size, UInt32 offset = TE_NULL) = TE_NULL;
+    };
+
+    // A persistently mapped upload ring. Allocate() may be called from any thread and returns nullptr
+    // when the ring is full; the render thread reads a range with GPU-side copies, marks it with
+    // Consume(), and Fence() recycles the ranges the GPU has finished with.
+    class StagingBuffer
+    {
+        public:
+            StagingBuffer() = default;
+            virtual ~StagingBuffer() = default;
+
+            virtual void Bind() const = TE_NULL;
+            virtual void Unbind() const = TE_NULL;
+            virtual StagingBufferID GetID() const = TE_NULL;
+            virtual UInt64 GetCapacity() const = TE_NULL;
+            virtual void* Allocate(UInt64 size, UInt64& offset) = TE_NULL;
+            virtual void Consume(UInt64 offset) = TE_NULL;
+            virtual void Fence() = TE_NULL;
+    };
+
     Ref<VertexBuffer> CreateVertexBuffer(UInt32 allocatorSize);
     Ref<VertexBuffer> CreateVertexBuffer(VertexBufferData data, UInt32 size);
+    Ref<StreamVertexBuffer> CreateStreamVertexBuffer(UInt32 capacity);
     Ref<IndexBuffer> CreateIndexBuffer(IndexBufferData data, UInt32 count);
+    Ref<StorageBuffer> CreateStorageBuffer(UInt32 size);
+    Ref<UniformBuffer> CreateUniformBuffer(UInt32 size);
+    Ref<StagingBuffer> CreateStagingBuffer(UInt64 capacity);
+    UInt32 GetUniformBufferOffsetAlignment();
 
 }
\ No newline at end of file
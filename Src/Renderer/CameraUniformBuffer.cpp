@@ -0,0 +1,57 @@
+#include "CameraUniformBuffer.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt32 MAX_CAMERA_SLOTS          = 192;
+
+    struct CameraBufferData
+    {
+        Ref<UniformBuffer> Buffer{ nullptr };
+        UInt32 SlotStride{ TE_NULL };
+        UInt32 NextSlot{ TE_NULL };
+        Float Time{ 0.0f };
+
+    }; static CameraBufferData s_CameraData;
+
+    void CameraUniformBuffer::Init()
+    {
+        UInt32 alignment = GetUniformBufferOffsetAlignment();
+        TRIMANA_ASSERT(alignment, "Uniform buffer offset alignment is unknown");
+        s_CameraData.SlotStride = (sizeof(CameraUniforms) + alignment - 1) / alignment * alignment;
+        s_CameraData.Buffer = CreateUniformBuffer(s_CameraData.SlotStride * MAX_CAMERA_SLOTS);
+        s_CameraData.NextSlot = TE_NULL;
+    }
+
+    void CameraUniformBuffer::Shutdown()
+    {
+        s_CameraData.Buffer = nullptr;
+    }
+
+    void CameraUniformBuffer::SetTime(Float time)
+    {
+        s_CameraData.Time = time;
+    }
+
+    // Every view gets its own slot, so passes that reuse a camera only need to bind its range again.
+    UInt32 CameraUniformBuffer::Push(const Mat4& view, const Mat4& projection, const Mat4& viewProjection)
+    {
+        TRIMANA_ASSERT(s_CameraData.Buffer, "CameraUniformBuffer::Init was not called");
+
+        CameraUniforms uniforms;
+        uniforms.View               = view;
+        uniforms.Projection         = projection;
+        uniforms.ViewProjection     = viewProjection;
+        uniforms.Time               = s_CameraData.Time;
+
+        UInt32 slot = s_CameraData.NextSlot;
+        s_CameraData.NextSlot = (s_CameraData.NextSlot + 1) % MAX_CAMERA_SLOTS;
+        s_CameraData.Buffer->SetData(&uniforms, sizeof(CameraUniforms), slot * s_CameraData.SlotStride);
+        return slot;
+    }
+
+    void CameraUniformBuffer::Bind(UInt32 slot)
+    {
+        s_CameraData.Buffer->BindRange(CAMERA_UNIFORM_BINDING, slot * s_CameraData.SlotStride, sizeof(CameraUniforms));
+    }
+}
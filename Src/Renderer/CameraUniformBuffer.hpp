@@ -0,0 +1,34 @@
+#pragma once
+
+#include "TypeDef.hpp"
+#include "Buffers.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt32 CAMERA_UNIFORM_BINDING = 0;
+
+    // Mirrors the std140 `Camera` block declared by the vertex shaders.
+    struct CameraUniforms
+    {
+        Mat4 View{ 1.0f };
+        Mat4 Projection{ 1.0f };
+        Mat4 ViewProjection{ 1.0f };
+        Float Time{ 0.0f };                 // seconds of completed frames, set by Renderer2D::Begin
+        Float Padding[3]{};
+    };
+
+    class CameraUniformBuffer
+    {
+        private:
+            CameraUniformBuffer() = default;
+            ~CameraUniformBuffer() = default;
+
+        public:
+            static void Init();
+            static void Shutdown();
+
+            static void SetTime(Float time);
+            static UInt32 Push(const Mat4& view, const Mat4& projection, const Mat4& viewProjection);
+            static void Bind(UInt32 slot);
+    };
+}
@@ -0,0 +1,44 @@
+#include "GPUProfiler.hpp"
+#include "Renderer.hpp"
+#include "Asserts.hpp"
+
+#include "OpenGL/OpenGL.hpp"
+
+namespace TE::Renderer
+{
+    void GPUProfiler::BeginFrame()
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(false, "No rendering API selected"); break;
+            case RendererAPI::OpenGL:       TE::APIs::OpenGL::GL_GPUProfiler::BeginFrame(); break;
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(false, "Not implemented yet"); break;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(false, "Not implemented yet"); break;
+            default:                        break;
+        };
+    }
+
+    UInt32 GPUProfiler::BeginScope(CString name)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(false, "No rendering API selected"); return TE_NULL;
+            case RendererAPI::OpenGL:       return TE::APIs::OpenGL::GL_GPUProfiler::BeginScope(name);
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(false, "Not implemented yet"); return TE_NULL;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(false, "Not implemented yet"); return TE_NULL;
+            default:                        return TE_NULL;
+        };
+    }
+
+    void GPUProfiler::EndScope(UInt32 scope)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:         TRIMANA_ASSERT(false, "No rendering API selected"); break;
+            case RendererAPI::OpenGL:       TE::APIs::OpenGL::GL_GPUProfiler::EndScope(scope); break;
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(false, "Not implemented yet"); break;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(false, "Not implemented yet"); break;
+            default:                        break;
+        };
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "TypeDef.hpp"
+#include "Instrument.hpp"
+
+namespace TE::Renderer
+{
+    // Brackets GPU work with timestamp queries and merges the measured intervals into the profiler
+    // trace on a "GPU" track, each linked by a flow to the CPU scope that submitted it. Results lag a
+    // few frames behind, so BeginFrame() must be called once per frame to recycle the query pool.
+    class GPUProfiler
+    {
+        private:
+            GPUProfiler() = default;
+            ~GPUProfiler() = default;
+
+        public:
+            static void BeginFrame();
+            static UInt32 BeginScope(CString name);
+            static void EndScope(UInt32 scope);
+    };
+
+    class GPUProfileScope
+    {
+        public:
+            explicit GPUProfileScope(CString name) : m_Scope(GPUProfiler::BeginScope(name)) {}
+            ~GPUProfileScope() { GPUProfiler::EndScope(m_Scope); }
+
+            GPUProfileScope(const GPUProfileScope&) = delete;
+            GPUProfileScope& operator=(const GPUProfileScope&) = delete;
+
+        private:
+            UInt32 m_Scope{ TE_NULL };
+    };
+}
+
+#ifdef TRIMANA_INSTRUMENTS_ENABLED
+
+#define TE_GPU_PROFILE_FRAME() TE::Renderer::GPUProfiler::BeginFrame()
+#define TE_GPU_PROFILE_SCOPE(name) TE::Renderer::GPUProfileScope TE_PROFILE_CONCAT(gpu_profile_scope_, __LINE__)(name)
+
+#else
+
+#define TE_GPU_PROFILE_FRAME()
+#define TE_GPU_PROFILE_SCOPE(name)
+
+#endif
@@ -0,0 +1,214 @@
+#include <cmath>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define TE_QUAD_KERNEL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define TE_QUAD_KERNEL_SSE2
+#endif
+
+#include "QuadKernel.hpp"
+
+namespace TE::Renderer
+{
+    static const Vec4 QUAD_CORNERS[] = { { -0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, 0.5f, 0.0f, 1.0f }, { -0.5f, 0.5f, 0.0f, 1.0f } };
+
+    static inline Vec2* Corner(Vec2* positions, UInt32 stride, UInt32 index)
+    {
+        return reinterpret_cast<Vec2*>(reinterpret_cast<UInt8*>(positions) + static_cast<std::size_t>(index) * stride);
+    }
+
+    // The affine form of translate * rotate * scale applied to the unit quad corners. With
+    // a = w/2 cos, b = w/2 sin, d = h/2 sin, e = h/2 cos the corners are (x -+ a +- d, y -+ b -+ e).
+    static void WriteQuadCornersAffine(const QuadDesc* quads, UInt32 count, Vec2* positions, UInt32 stride)
+    {
+        for(UInt32 i = 0; i < count; i++)
+        {
+            const QuadDesc& quad = quads[i];
+            const Float s = std::sin(quad.Rotation);
+            const Float c = std::cos(quad.Rotation);
+            const Float a = 0.5f * quad.Size.x * c, b = 0.5f * quad.Size.x * s;
+            const Float d = 0.5f * quad.Size.y * s, e = 0.5f * quad.Size.y * c;
+            const Float x = quad.Position.x, y = quad.Position.y;
+
+            *Corner(positions, stride, i * 4 + 0) = { x - a + d, y - b - e };
+            *Corner(positions, stride, i * 4 + 1) = { x + a + d, y + b - e };
+            *Corner(positions, stride, i * 4 + 2) = { x + a - d, y + b + e };
+            *Corner(positions, stride, i * 4 + 3) = { x - a - d, y - b + e };
+        }
+    }
+
+    // Cody-Waite reduction by pi/2 followed by the Cephes minimax polynomials on [-pi/4, pi/4]; within
+    // 2 ulp of std::sin/std::cos for the rotations a 2D scene uses, and exact at zero.
+    static const Float SINCOS_TWO_OVER_PI   = 0.636619772f;
+    static const Float SINCOS_PI_OVER_2[]   = { 1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f };
+    static const Float SINCOS_SIN[]         = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+    static const Float SINCOS_COS[]         = { 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+
+#if defined(TE_QUAD_KERNEL_AVX2)
+    static const UInt32 QUAD_KERNEL_LANES = 8;
+
+    static inline void SinCosLanes(__m256 angle, __m256& sine, __m256& cosine)
+    {
+        const __m256i one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+        __m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(angle, _mm256_set1_ps(SINCOS_TWO_OVER_PI)));
+        __m256 fq = _mm256_cvtepi32_ps(q);
+
+        __m256 r = _mm256_sub_ps(angle, _mm256_mul_ps(fq, _mm256_set1_ps(SINCOS_PI_OVER_2[0])));
+        r = _mm256_sub_ps(r, _mm256_mul_ps(fq, _mm256_set1_ps(SINCOS_PI_OVER_2[1])));
+        r = _mm256_sub_ps(r, _mm256_mul_ps(fq, _mm256_set1_ps(SINCOS_PI_OVER_2[2])));
+        __m256 r2 = _mm256_mul_ps(r, r);
+
+        __m256 ps = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SINCOS_SIN[2]), r2), _mm256_set1_ps(SINCOS_SIN[1]));
+        ps = _mm256_add_ps(_mm256_mul_ps(ps, r2), _mm256_set1_ps(SINCOS_SIN[0]));
+        ps = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(ps, r2), r), r);
+
+        __m256 pc = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SINCOS_COS[2]), r2), _mm256_set1_ps(SINCOS_COS[1]));
+        pc = _mm256_add_ps(_mm256_mul_ps(pc, r2), _mm256_set1_ps(SINCOS_COS[0]));
+        pc = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(pc, r2), r2), _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), r2)));
+
+        __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+        __m256 sin_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30));
+        __m256 cos_sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30));
+        sine = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, swap), sin_sign);
+        cosine = _mm256_xor_ps(_mm256_blendv_ps(pc, ps, swap), cos_sign);
+    }
+
+    // Interleaves one corner of every lane and stores it straight to the strided output.
+    static inline void StoreCornerLanes(Vec2* positions, UInt32 stride, UInt32 first, __m256 cornerX, __m256 cornerY)
+    {
+        __m256 lo = _mm256_unpacklo_ps(cornerX, cornerY), hi = _mm256_unpackhi_ps(cornerX, cornerY);
+        __m128 pairs[4] = { _mm256_castps256_ps128(lo), _mm256_castps256_ps128(hi), _mm256_extractf128_ps(lo, 1), _mm256_extractf128_ps(hi, 1) };
+        for(UInt32 k = 0; k < 4; k++)
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(Corner(positions, stride, first + (2 * k + 0) * 4)), pairs[k]);
+            _mm_storeh_pi(reinterpret_cast<__m64*>(Corner(positions, stride, first + (2 * k + 1) * 4)), pairs[k]);
+        }
+    }
+
+    static void WriteQuadCornersLanes(const QuadDesc* quads, UInt32 first, Vec2* positions, UInt32 stride)
+    {
+        const QuadDesc* q = quads;
+        __m256 vx = _mm256_setr_ps(q[0].Position.x, q[1].Position.x, q[2].Position.x, q[3].Position.x, q[4].Position.x, q[5].Position.x, q[6].Position.x, q[7].Position.x);
+        __m256 vy = _mm256_setr_ps(q[0].Position.y, q[1].Position.y, q[2].Position.y, q[3].Position.y, q[4].Position.y, q[5].Position.y, q[6].Position.y, q[7].Position.y);
+        __m256 vw = _mm256_setr_ps(q[0].Size.x, q[1].Size.x, q[2].Size.x, q[3].Size.x, q[4].Size.x, q[5].Size.x, q[6].Size.x, q[7].Size.x);
+        __m256 vh = _mm256_setr_ps(q[0].Size.y, q[1].Size.y, q[2].Size.y, q[3].Size.y, q[4].Size.y, q[5].Size.y, q[6].Size.y, q[7].Size.y);
+        __m256 vr = _mm256_setr_ps(q[0].Rotation, q[1].Rotation, q[2].Rotation, q[3].Rotation, q[4].Rotation, q[5].Rotation, q[6].Rotation, q[7].Rotation);
+
+        __m256 vs, vc;
+        SinCosLanes(vr, vs, vc);
+        vw = _mm256_mul_ps(vw, _mm256_set1_ps(0.5f));
+        vh = _mm256_mul_ps(vh, _mm256_set1_ps(0.5f));
+
+        __m256 a = _mm256_mul_ps(vw, vc), b = _mm256_mul_ps(vw, vs);
+        __m256 d = _mm256_mul_ps(vh, vs), e = _mm256_mul_ps(vh, vc);
+
+        StoreCornerLanes(positions, stride, first + 0, _mm256_add_ps(_mm256_sub_ps(vx, a), d), _mm256_sub_ps(_mm256_sub_ps(vy, b), e));
+        StoreCornerLanes(positions, stride, first + 1, _mm256_add_ps(_mm256_add_ps(vx, a), d), _mm256_sub_ps(_mm256_add_ps(vy, b), e));
+        StoreCornerLanes(positions, stride, first + 2, _mm256_sub_ps(_mm256_add_ps(vx, a), d), _mm256_add_ps(_mm256_add_ps(vy, b), e));
+        StoreCornerLanes(positions, stride, first + 3, _mm256_sub_ps(_mm256_sub_ps(vx, a), d), _mm256_add_ps(_mm256_sub_ps(vy, b), e));
+    }
+#elif defined(TE_QUAD_KERNEL_SSE2)
+    static const UInt32 QUAD_KERNEL_LANES = 4;
+
+    static inline __m128 SelectLanes(__m128 mask, __m128 whenSet, __m128 whenClear)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, whenSet), _mm_andnot_ps(mask, whenClear));
+    }
+
+    static inline void SinCosLanes(__m128 angle, __m128& sine, __m128& cosine)
+    {
+        const __m128i one = _mm_set1_epi32(1), two = _mm_set1_epi32(2);
+        __m128i q = _mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(SINCOS_TWO_OVER_PI)));
+        __m128 fq = _mm_cvtepi32_ps(q);
+
+        __m128 r = _mm_sub_ps(angle, _mm_mul_ps(fq, _mm_set1_ps(SINCOS_PI_OVER_2[0])));
+        r = _mm_sub_ps(r, _mm_mul_ps(fq, _mm_set1_ps(SINCOS_PI_OVER_2[1])));
+        r = _mm_sub_ps(r, _mm_mul_ps(fq, _mm_set1_ps(SINCOS_PI_OVER_2[2])));
+        __m128 r2 = _mm_mul_ps(r, r);
+
+        __m128 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SINCOS_SIN[2]), r2), _mm_set1_ps(SINCOS_SIN[1]));
+        ps = _mm_add_ps(_mm_mul_ps(ps, r2), _mm_set1_ps(SINCOS_SIN[0]));
+        ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, r2), r), r);
+
+        __m128 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SINCOS_COS[2]), r2), _mm_set1_ps(SINCOS_COS[1]));
+        pc = _mm_add_ps(_mm_mul_ps(pc, r2), _mm_set1_ps(SINCOS_COS[0]));
+        pc = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(pc, r2), r2), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)));
+
+        __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+        __m128 sin_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+        __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+        sine = _mm_xor_ps(SelectLanes(swap, pc, ps), sin_sign);
+        cosine = _mm_xor_ps(SelectLanes(swap, ps, pc), cos_sign);
+    }
+
+    // Interleaves one corner of every lane and stores it straight to the strided output.
+    static inline void StoreCornerLanes(Vec2* positions, UInt32 stride, UInt32 first, __m128 cornerX, __m128 cornerY)
+    {
+        __m128 lo = _mm_unpacklo_ps(cornerX, cornerY), hi = _mm_unpackhi_ps(cornerX, cornerY);
+        _mm_storel_pi(reinterpret_cast<__m64*>(Corner(positions, stride, first + 0 * 4)), lo);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(Corner(positions, stride, first + 1 * 4)), lo);
+        _mm_storel_pi(reinterpret_cast<__m64*>(Corner(positions, stride, first + 2 * 4)), hi);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(Corner(positions, stride, first + 3 * 4)), hi);
+    }
+
+    static void WriteQuadCornersLanes(const QuadDesc* quads, UInt32 first, Vec2* positions, UInt32 stride)
+    {
+        const QuadDesc* q = quads;
+        __m128 vx = _mm_setr_ps(q[0].Position.x, q[1].Position.x, q[2].Position.x, q[3].Position.x);
+        __m128 vy = _mm_setr_ps(q[0].Position.y, q[1].Position.y, q[2].Position.y, q[3].Position.y);
+        __m128 vw = _mm_setr_ps(q[0].Size.x, q[1].Size.x, q[2].Size.x, q[3].Size.x);
+        __m128 vh = _mm_setr_ps(q[0].Size.y, q[1].Size.y, q[2].Size.y, q[3].Size.y);
+        __m128 vr = _mm_setr_ps(q[0].Rotation, q[1].Rotation, q[2].Rotation, q[3].Rotation);
+
+        __m128 vs, vc;
+        SinCosLanes(vr, vs, vc);
+        vw = _mm_mul_ps(vw, _mm_set1_ps(0.5f));
+        vh = _mm_mul_ps(vh, _mm_set1_ps(0.5f));
+
+        __m128 a = _mm_mul_ps(vw, vc), b = _mm_mul_ps(vw, vs);
+        __m128 d = _mm_mul_ps(vh, vs), e = _mm_mul_ps(vh, vc);
+
+        StoreCornerLanes(positions, stride, first + 0, _mm_add_ps(_mm_sub_ps(vx, a), d), _mm_sub_ps(_mm_sub_ps(vy, b), e));
+        StoreCornerLanes(positions, stride, first + 1, _mm_add_ps(_mm_add_ps(vx, a), d), _mm_sub_ps(_mm_add_ps(vy, b), e));
+        StoreCornerLanes(positions, stride, first + 2, _mm_sub_ps(_mm_add_ps(vx, a), d), _mm_add_ps(_mm_add_ps(vy, b), e));
+        StoreCornerLanes(positions, stride, first + 3, _mm_sub_ps(_mm_sub_ps(vx, a), d), _mm_add_ps(_mm_sub_ps(vy, b), e));
+    }
+#endif
+
+    void WriteQuadCorners(const QuadDesc* quads, UInt32 count, Vec2* positions, UInt32 stride)
+    {
+#if defined(TE_QUAD_KERNEL_AVX2) || defined(TE_QUAD_KERNEL_SSE2)
+        UInt32 i = 0;
+        for(; i + QUAD_KERNEL_LANES <= count; i += QUAD_KERNEL_LANES)
+            WriteQuadCornersLanes(quads + i, i * 4, positions, stride);
+
+        WriteQuadCornersAffine(quads + i, count - i, Corner(positions, stride, i * 4), stride);
+#else
+        WriteQuadCornersAffine(quads, count, positions, stride);
+#endif
+    }
+
+    void WriteQuadCornersScalar(const QuadDesc* quads, UInt32 count, Vec2* positions, UInt32 stride)
+    {
+        for(UInt32 i = 0; i < count; i++)
+        {
+            const QuadDesc& quad = quads[i];
+            Mat4 transform = glm::translate(Mat4(1.0f), quad.Position) * glm::rotate(Mat4(1.0f), quad.Rotation, { 0.0f, 0.0f, 1.0f }) * glm::scale(Mat4(1.0f), { quad.Size.x, quad.Size.y, 1.0f });
+            for(UInt32 corner = 0; corner < 4; corner++)
+                *Corner(positions, stride, i * 4 + corner) = Vec2(transform * QUAD_CORNERS[corner]);
+        }
+    }
+
+    CString QuadKernelInstructionSet()
+    {
+#if defined(TE_QUAD_KERNEL_AVX2)
+        return "AVX2";
+#elif defined(TE_QUAD_KERNEL_SSE2)
+        return "SSE2";
+#else
+        return "Scalar";
+#endif
+    }
+}
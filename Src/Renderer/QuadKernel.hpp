@@ -0,0 +1,24 @@
+#pragma once
+
+#include "TypeDef.hpp"
+
+namespace TE::Renderer
+{
+    class Texture2D;
+
+    struct QuadDesc
+    {
+        Vec3 Position{ 0.0f };
+        Vec2 Size{ 1.0f };
+        Float Rotation{ 0.0f };
+        Vec4 Color{ 1.0f };
+        Ref<Texture2D> Texture{ nullptr };
+        Float TilingFactor{ 1.0f };
+    };
+
+    // Both write the four corners of quads[i] to positions[4 * i .. 4 * i + 3], advancing `stride` bytes per corner.
+    void WriteQuadCorners(const QuadDesc* quads, UInt32 count, Vec2* positions, UInt32 stride);
+    void WriteQuadCornersScalar(const QuadDesc* quads, UInt32 count, Vec2* positions, UInt32 stride);
+
+    CString QuadKernelInstructionSet();
+}
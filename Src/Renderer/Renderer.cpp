@@ -1,5 +1,7 @@
 #include "Renderer.hpp"
 #include "Asserts.hpp"
+#include "CameraUniformBuffer.hpp"
+#include "TextureLoader.hpp"
 
 #include "OpenGL/OpenGL.hpp"
 
@@ -31,9 +33,15 @@ namespace TE::Renderer
                 break;
             }
         }
+
+        CameraUniformBuffer::Init();
+        TextureLoader::Init();
     }
     void Renderer::Shutdown()
     {
+        TextureLoader::Shutdown();
+        CameraUniformBuffer::Shutdown();
+
         switch(s_RendererAPI)
         {
             case RendererAPI::OpenGL:
@@ -1,4 +1,11 @@
+#include <cstring>
+#include <algorithm>
+
+#include <glm/gtc/packing.hpp>
+
 #include "Renderer2D.hpp"
+#include "GPUProfiler.hpp"
+#include "FrameStats.hpp"
 
 namespace TE::Renderer
 {
@@ -7,68 +14,432 @@ namespace TE::Renderer
     static const UInt32 MAX_INDICES               = MAX_QUADS * 6;
     static const UInt32 MAX_TEXTURE_SLOTS         = 32;
     static const UInt32 MAX_QUAD_VERTEX_COUNT     = 4;
+    static const UInt32 QUAD_INDEX_COUNT          = 6;
+    static const UInt32 STREAM_FRAME_COUNT        = 3;
+    static const UInt32 PULLED_QUAD_BINDING       = 1;
+    static const UInt32 MAX_PACKED_TEXTURE_INDEX  = 0xFFFF;
+    static const UInt32 UNMAPPED_TEXTURE_SLOT     = 0xFFFFFFFF;
     static const Vec4 DEFAULT_COLOR               = { 1.0f, 1.0f, 1.0f, 1.0f };
     static const Vec2 DEFAULT_TEX_COORDS[]        = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+    static const Vec4 QUAD_VERTEX_POSITIONS[]     = { { -0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, 0.5f, 0.0f, 1.0f }, { -0.5f, 0.5f, 0.0f, 1.0f } };
 
-    struct Vertex 
-    {
-		Vec3 Position;
-		Vec4 Color;
-		Vec2 TexCoords;
-		Float TexIndex;
-		Float TilingFactor;
-	};
+    // Untextured stand-ins drawn until the real programs finish linking. They read the same vertex
+    // inputs as the program they replace and are small enough to link synchronously at Init.
+    static const char* PLACEHOLDER_CAMERA_BLOCK = R"(
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_View;
+    mat4 u_Projection;
+    mat4 u_ViewProjection;
+    float u_Time;
+};
+)";
+
+    static const char* PLACEHOLDER_BATCH_VERTEX = R"(
+layout(location = 0) in vec2 u_Position;
+layout(location = 1) in vec4 u_Color;
+layout(location = 3) in uint u_DepthTexIndex;
+
+out vec4 v_Color;
+
+void main()
+{
+    v_Color = u_Color;
+    gl_Position = u_ViewProjection * vec4(u_Position, unpackHalf2x16(u_DepthTexIndex >> 16).x, 1.0);
+}
+)";
+
+    static const char* PLACEHOLDER_INSTANCED_VERTEX = R"(
+layout(location = 0) in vec3 u_Position;
+layout(location = 1) in vec2 u_Size;
+layout(location = 2) in float u_Rotation;
+layout(location = 3) in vec4 u_Color;
+
+out vec4 v_Color;
+
+const vec2 QUAD_CORNERS[4] = vec2[4](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+
+void main()
+{
+    vec2 corner = QUAD_CORNERS[gl_VertexID] * u_Size;
+    vec2 rotated = vec2(corner.x * cos(u_Rotation) - corner.y * sin(u_Rotation), corner.x * sin(u_Rotation) + corner.y * cos(u_Rotation));
+
+    v_Color = u_Color;
+    gl_Position = u_ViewProjection * vec4(u_Position.xy + rotated, u_Position.z, 1.0);
+}
+)";
+
+    static const char* PLACEHOLDER_PULLED_VERTEX = R"(
+struct PackedQuad
+{
+    vec3 Position;
+    float Rotation;
+    vec2 Size;
+    uint Color;
+    uint TexIndex;
+    uvec2 TexRect;
+    float TilingFactor;
+    float Padding;
+};
+
+layout(std430, binding = 1) readonly buffer QuadBuffer
+{
+    PackedQuad u_Quads[];
+};
+
+out vec4 v_Color;
+
+const int QUAD_INDICES[6] = int[6](0, 1, 2, 2, 3, 0);
+const vec2 QUAD_CORNERS[4] = vec2[4](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));
+
+void main()
+{
+    PackedQuad quad = u_Quads[gl_VertexID / 6];
+    vec2 corner = QUAD_CORNERS[QUAD_INDICES[gl_VertexID % 6]] * quad.Size;
+    vec2 rotated = vec2(corner.x * cos(quad.Rotation) - corner.y * sin(quad.Rotation), corner.x * sin(quad.Rotation) + corner.y * cos(quad.Rotation));
+
+    v_Color = unpackUnorm4x8(quad.Color);
+    gl_Position = u_ViewProjection * vec4(quad.Position.xy + rotated, quad.Position.z, 1.0);
+}
+)";
+
+    static const char* PLACEHOLDER_FRAGMENT = R"(#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+
+in vec4 v_Color;
+
+void main()
+{
+    o_Color = v_Color;
+}
+)";
 
     struct BatchData 
     {
+        Renderer2DMode Mode{ Renderer2DMode::Batch };
+        UInt32 CameraSlot{ TE_NULL };
+
         Ref<VertexArray> QuadVAO{ nullptr };
         Ref<VertexBuffer> QuadVBO{ nullptr };
+        Ref<StreamVertexBuffer> QuadStream{ nullptr };
         Ref<IndexBuffer> QuadIBO{ nullptr };
 
+        Ref<VertexArray> InstanceVAO{ nullptr };
+        Ref<VertexBuffer> InstanceVBO{ nullptr };
+        Ref<StreamVertexBuffer> InstanceStream{ nullptr };
+        Ref<IndexBuffer> InstanceIBO{ nullptr };
+
+        Ref<VertexArray> PulledVAO{ nullptr };
+        Ref<StorageBuffer> PulledSSBO{ nullptr };
+        Ref<StreamVertexBuffer> PulledStream{ nullptr };
+
         Ref<Texture2D> PlainTexture{ nullptr };
         UInt32 PlainTextureSlot{ TE_NULL };
         UInt32 IndexCount{ TE_NULL };
+        UInt32 InstanceCount{ TE_NULL };
+        UInt32 BaseVertex{ TE_NULL };
+        UInt32 BaseInstance{ TE_NULL };
+        UInt32 BasePulledQuad{ TE_NULL };
+
+        QuadVertex* QuadBuffer{ nullptr };
+        QuadVertex* QuadBufferPtr{ nullptr };
+
+        QuadInstance* InstanceBuffer{ nullptr };
+        QuadInstance* InstanceBufferPtr{ nullptr };
 
-        Vertex* QuadBuffer{ nullptr };
-        Vertex* QuadBufferPtr{ nullptr };
+        PackedQuad* PulledBuffer{ nullptr };
+        PackedQuad* PulledBufferPtr{ nullptr };
 
+        ShaderLibrary Shaders;
         Ref<Shader> BatchShader{ nullptr };
+        Ref<Shader> InstanceShader{ nullptr };
+        Ref<Shader> PulledShader{ nullptr };
         std::array<Ref<Texture2D>, MAX_TEXTURE_SLOTS> TextureSlots;
         UInt32 TextureSlotIndex{ 1 };
+        Ref<TextureTable> Textures{ nullptr };
+
+        Boolean Sorting{ TE_FALSE };
+        UInt8 SortLayer{ TE_NULL };
+        Renderer2DRecorder DeferredQuads{ Renderer2DMode::Batch };
+        std::vector<UInt64> SortKeys;
+        std::vector<UInt64> SortKeysScratch;
+        std::vector<UInt32> SortOrder;
+        std::vector<UInt32> SortOrderScratch;
+
+        std::vector<UInt32> BulkTextureIndices;
+        std::vector<UInt32> MergeTextureSlots;
 
         Renderer2D::Status RenderingStatus;
-        Vec4 QuadVertexPositions[MAX_QUAD_VERTEX_COUNT];
 
     }; static BatchData s_BatchData;
 
-    void Renderer2D::Restart() 
+    static Mat4 QuadTransform(const Vec3& position, const Vec2& size, Float rotation)
+    {
+        return glm::translate(Mat4(1.0f), position) * glm::rotate(Mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f }) * glm::scale(Mat4(1.0f), { size.x, size.y, 1.0f });
+    }
+
+    // Instanced quads only carry position, size and a Z rotation, so the transform is
+    // decomposed under the assumption that it has no shear.
+    static void DecomposeTransform(const Mat4& transform, Vec3& position, Vec2& size, Float& rotation)
+    {
+        position    = Vec3(transform[3]);
+        size        = { glm::length(Vec2(transform[0])), glm::length(Vec2(transform[1])) };
+        rotation    = glm::atan(transform[0].y, transform[0].x);
+    }
+
+    static UInt32 PackDepthTexIndex(Float depth, UInt32 textureIndex)
+    {
+        TRIMANA_ASSERT(textureIndex <= MAX_PACKED_TEXTURE_INDEX, "Texture index does not fit the packed vertex format");
+        return (static_cast<UInt32>(glm::packHalf1x16(depth)) << 16) | (textureIndex & MAX_PACKED_TEXTURE_INDEX);
+    }
+
+    static void WriteQuadVertices(QuadVertex* vertices, const Mat4& transform, const Vec4& color, const Vec2* texCoords, Float textureIndex, Float tilingFactor)
+    {
+        const UInt32 packed_color = glm::packUnorm4x8(color);
+		for(UInt32 i = 0; i < MAX_QUAD_VERTEX_COUNT; i++) 
+        {
+            Vec4 position                   = transform * QUAD_VERTEX_POSITIONS[i];
+			vertices[i].Position            = { position.x, position.y };
+			vertices[i].Color               = packed_color;
+			vertices[i].TexCoords           = glm::packHalf2x16(texCoords[i] * tilingFactor);
+			vertices[i].DepthTexIndex       = PackDepthTexIndex(position.z, static_cast<UInt32>(textureIndex));
+		}
+    }
+
+    static void WriteQuadInstance(QuadInstance* instance, const Vec3& position, const Vec2& size, Float rotation, const Vec4& color, const Vec2* texCoords, Float textureIndex, Float tilingFactor)
+    {
+        instance->Position          = position;
+        instance->Size              = size;
+        instance->Rotation          = rotation;
+        instance->Color             = color;
+        instance->TexRect           = { texCoords[0].x, texCoords[0].y, texCoords[2].x, texCoords[2].y };
+        instance->TexIndex          = textureIndex;
+        instance->TilingFactor      = tilingFactor;
+    }
+
+    static void WritePackedQuad(PackedQuad* quad, const Vec3& position, const Vec2& size, Float rotation, const Vec4& color, const Vec4& texRect, Float textureIndex, Float tilingFactor)
+    {
+        quad->Position              = position;
+        quad->Rotation              = rotation;
+        quad->Size                  = size;
+        quad->Color                 = glm::packUnorm4x8(color);
+        quad->TexIndex              = static_cast<UInt32>(textureIndex);
+        quad->TexRect[0]            = glm::packHalf2x16({ texRect.x, texRect.y });
+        quad->TexRect[1]            = glm::packHalf2x16({ texRect.z, texRect.w });
+        quad->TilingFactor          = tilingFactor;
+    }
+
+    // Key layout, most significant first: layer (8) | depth (16) | blend (8) | texture serial (32).
+    static UInt64 MakeSortKey(Float depth, Float alpha, const Ref<Texture2D>& texture)
+    {
+        UInt32 depth_bits{ TE_NULL };
+        std::memcpy(&depth_bits, &depth, sizeof(depth_bits));
+        depth_bits = (depth_bits & 0x80000000u) ? ~depth_bits : (depth_bits | 0x80000000u);
+
+        UInt64 blend = (alpha < 1.0f) ? 1 : 0;
+        return (static_cast<UInt64>(s_BatchData.SortLayer) << 56) | (static_cast<UInt64>(depth_bits >> 16) << 40) | (blend << 32) | (texture->GetSerial() & 0xFFFFFFFF);
+    }
+
+    static void RadixSort(std::vector<UInt64>& keys, std::vector<UInt32>& order, std::vector<UInt64>& keysScratch, std::vector<UInt32>& orderScratch)
+    {
+        const UInt32 count = static_cast<UInt32>(keys.size());
+        order.resize(count);
+        keysScratch.resize(count);
+        orderScratch.resize(count);
+
+        for(UInt32 i = 0; i < count; i++)
+            order[i] = i;
+
+        for(UInt32 shift = 0; shift < 64; shift += 8)
+        {
+            UInt32 histogram[256] = {};
+            for(UInt32 i = 0; i < count; i++)
+                histogram[(keys[i] >> shift) & 0xFF]++;
+
+            if(histogram[(keys[0] >> shift) & 0xFF] == count)
+                continue;
+
+            UInt32 offset = 0;
+            for(UInt32 bucket = 0; bucket < 256; bucket++)
+            {
+                UInt32 bucket_count = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucket_count;
+            }
+
+            for(UInt32 i = 0; i < count; i++)
+            {
+                UInt32 destination = histogram[(keys[i] >> shift) & 0xFF]++;
+                keysScratch[destination] = keys[i];
+                orderScratch[destination] = order[i];
+            }
+
+            keys.swap(keysScratch);
+            order.swap(orderScratch);
+        }
+    }
+
+    static String FragmentShaderPath(const String& name)
+    {
+        if(!s_BatchData.Textures)
+            return "Assets/Shaders/" + name + "-Fragment.glsl";
+
+        switch(s_BatchData.Textures->GetType())
+        {
+            case TextureTableType::Bindless:        return "Assets/Shaders/Renderer2D-Bindless-Fragment.glsl";
+            case TextureTableType::TextureArray:    return "Assets/Shaders/Renderer2D-TextureArray-Fragment.glsl";
+            default:                                return "Assets/Shaders/" + name + "-Fragment.glsl";
+        }
+    }
+
+    // A full table cannot place the texture; it is drawn with the plain texture, which Init registers
+    // first so it always holds a layer.
+    static UInt32 TableIndex(const Ref<Texture2D>& texture)
+    {
+        UInt32 index = s_BatchData.Textures->GetIndex(texture);
+        if(index == INVALID_TEXTURE_INDEX)
+            index = s_BatchData.Textures->GetIndex(s_BatchData.PlainTexture);
+
+        return index;
+    }
+
+    // The placeholder is linked before returning, so Get() always has something drawable for this name.
+    static Ref<Shader> LoadShader(const String& name, const Path& vtxShader, const Path& fragShader, const char* placeholderVertex)
+    {
+        Ref<Shader> shader = s_BatchData.Shaders.Load(name, vtxShader, fragShader);
+
+        String placeholder_vertex = String("#version 450 core\n") + PLACEHOLDER_CAMERA_BLOCK + placeholderVertex;
+        Ref<Shader> placeholder = CreateShaderFromSource(name + "-Placeholder", placeholder_vertex, PLACEHOLDER_FRAGMENT);
+        if(placeholder && placeholder->IsValid())
+            s_BatchData.Shaders.SetPlaceholder(name, placeholder);
+
+        return shader;
+    }
+
+    static BufferLayout QuadVertexLayout()
+    {
+        return {
+            {"u_Position", BufferDataType::Float, BufferComponents::XY, TE_FALSE },
+            {"u_Color", BufferDataType::UInt8, BufferComponents::RGBA, TE_TRUE },
+            {"u_TexCoords", BufferDataType::Half, BufferComponents::UV, TE_FALSE },
+            {"u_DepthTexIndex", BufferDataType::UInt32, BufferComponents::X, TE_FALSE }
+        };
+    }
+
+    static const Ref<Shader>& ActiveProgram()
+    {
+        switch(s_BatchData.Mode)
+        {
+            case Renderer2DMode::Instanced:         return s_BatchData.InstanceShader;
+            case Renderer2DMode::VertexPulling:     return s_BatchData.PulledShader;
+            default:                                return s_BatchData.BatchShader;
+        }
+    }
+
+    // Programs link in the background; until the driver reports completion the library hands out the
+    // mode's placeholder, so batches keep drawing and a pending program never stalls the render thread.
+    static void BindActiveShader()
+    {
+        s_BatchData.Shaders.Get(ActiveProgram()->GetName())->Bind();
+    }
+
+    // With stream buffers the batch is written straight into the ring the GPU reads from. A full batch
+    // is reserved, but only the bytes actually written are released, so small flushes pack tightly.
+    static void ReserveBatchBuffers()
     {
-        End();
+        if(s_BatchData.QuadStream)
+        {
+            s_BatchData.QuadBuffer = static_cast<QuadVertex*>(s_BatchData.QuadStream->Reserve(MAX_VERTICES * sizeof(QuadVertex)));
+            s_BatchData.BaseVertex = s_BatchData.QuadStream->GetReservedOffset() / sizeof(QuadVertex);
+        }
+
+        if(s_BatchData.InstanceStream)
+        {
+            s_BatchData.InstanceBuffer = static_cast<QuadInstance*>(s_BatchData.InstanceStream->Reserve(MAX_QUADS * sizeof(QuadInstance)));
+            s_BatchData.BaseInstance = s_BatchData.InstanceStream->GetReservedOffset() / sizeof(QuadInstance);
+        }
+
+        if(s_BatchData.PulledStream)
+        {
+            s_BatchData.PulledBuffer = static_cast<PackedQuad*>(s_BatchData.PulledStream->Reserve(MAX_QUADS * sizeof(PackedQuad)));
+            s_BatchData.BasePulledQuad = s_BatchData.PulledStream->GetReservedOffset() / sizeof(PackedQuad);
+        }
+
         s_BatchData.QuadBufferPtr = s_BatchData.QuadBuffer;
+        s_BatchData.InstanceBufferPtr = s_BatchData.InstanceBuffer;
+        s_BatchData.PulledBufferPtr = s_BatchData.PulledBuffer;
+    }
+
+    static void ReleaseBatchBuffers()
+    {
+        if(s_BatchData.QuadStream)
+            s_BatchData.QuadStream->Release(static_cast<UInt32>((UInt8*)s_BatchData.QuadBufferPtr - (UInt8*)s_BatchData.QuadBuffer));
+
+        if(s_BatchData.InstanceStream)
+            s_BatchData.InstanceStream->Release(static_cast<UInt32>((UInt8*)s_BatchData.InstanceBufferPtr - (UInt8*)s_BatchData.InstanceBuffer));
+
+        if(s_BatchData.PulledStream)
+            s_BatchData.PulledStream->Release(static_cast<UInt32>((UInt8*)s_BatchData.PulledBufferPtr - (UInt8*)s_BatchData.PulledBuffer));
+    }
+
+    static void FlushBatch()
+    {
+        if(s_BatchData.Mode == Renderer2DMode::Instanced && !s_BatchData.InstanceStream)
+        {
+            UInt32 size = (UInt8*)s_BatchData.InstanceBufferPtr - (UInt8*)s_BatchData.InstanceBuffer;
+            s_BatchData.InstanceVBO->Bind();
+            s_BatchData.InstanceVBO->SetData(s_BatchData.InstanceBuffer, size);
+        }
+
+        if(s_BatchData.Mode == Renderer2DMode::Batch && !s_BatchData.QuadStream)
+        {
+            UInt32 size = (UInt8*)s_BatchData.QuadBufferPtr - (UInt8*)s_BatchData.QuadBuffer;
+            s_BatchData.QuadVBO->Bind();
+            s_BatchData.QuadVBO->SetData(s_BatchData.QuadBuffer, size);
+        }
+
+        if(s_BatchData.Mode == Renderer2DMode::VertexPulling && !s_BatchData.PulledStream)
+        {
+            UInt32 size = (UInt8*)s_BatchData.PulledBufferPtr - (UInt8*)s_BatchData.PulledBuffer;
+            s_BatchData.PulledSSBO->SetData(s_BatchData.PulledBuffer, size);
+        }
+
+        Renderer2D::Flush();
+        ReleaseBatchBuffers();
+    }
+
+    // With a texture table only a full stream region ends a batch, so a frame issues one draw per
+    // MAX_QUADS quads; slot textures still flush whenever all MAX_TEXTURE_SLOTS are taken.
+    void Renderer2D::Restart()
+    {
+        FlushBatch();
+        ReserveBatchBuffers();
         s_BatchData.IndexCount = 0;
+        s_BatchData.InstanceCount = 0;
         s_BatchData.TextureSlotIndex = 1;
     }
 
     void Renderer2D::Init()
     {
-        s_BatchData.QuadBuffer = new Vertex[MAX_VERTICES];
+        s_BatchData.Textures = CreateTextureTable();
+        s_BatchData.QuadStream = CreateStreamVertexBuffer(STREAM_FRAME_COUNT * MAX_VERTICES * sizeof(QuadVertex));
+        s_BatchData.InstanceStream = CreateStreamVertexBuffer(STREAM_FRAME_COUNT * MAX_QUADS * sizeof(QuadInstance));
+
+        if(!s_BatchData.QuadStream)
+            s_BatchData.QuadBuffer = new QuadVertex[MAX_VERTICES];
+
         s_BatchData.QuadVAO = CreateVertexArray();
         s_BatchData.QuadVAO->Bind();
         {
-            s_BatchData.QuadVBO = CreateVertexBuffer(MAX_VERTICES * sizeof(Vertex));
+            s_BatchData.QuadVBO = s_BatchData.QuadStream ? s_BatchData.QuadStream : CreateVertexBuffer(MAX_VERTICES * sizeof(QuadVertex));
             s_BatchData.QuadVBO->Bind();
             {
-                s_BatchData.QuadVBO->SetLayout({
-                    {"u_Position", BufferComponents::XYZ, BufferStride::F3, TE_FALSE },
-                    {"u_Color", BufferComponents::RGBA, BufferStride::F4, TE_FALSE },
-                    {"u_TexCoords", BufferComponents::UV, BufferStride::F2, TE_FALSE },
-                    {"u_TexIndex", BufferComponents::X, BufferStride::F1, TE_FALSE },
-                    {"u_TilingFactor", BufferComponents::X, BufferStride::F1, TE_FALSE }
-                });
+                s_BatchData.QuadVBO->SetLayout(QuadVertexLayout());
 
                 s_BatchData.QuadVAO->EmplaceVtxBuffer(s_BatchData.QuadVBO);
 
-                UInt32 indices[MAX_INDICES];
+                UInt32* indices = new UInt32[MAX_INDICES];
                 UInt32 offset = 0;
                 for(UInt32 i = 0; i < MAX_INDICES; i += 6)
                 {
@@ -83,72 +454,227 @@ namespace TE::Renderer
 
                 s_BatchData.QuadIBO = CreateIndexBuffer(indices, MAX_INDICES);
                 s_BatchData.QuadVAO->EmplaceIdxBuffer(s_BatchData.QuadIBO);
+                delete[] indices;
 
                 for(UInt32 i = 0; i < MAX_TEXTURE_SLOTS; i++)
                     s_BatchData.TextureSlots[i] = nullptr;
 
                 s_BatchData.PlainTexture = CreateTexture2D(1, 1);
                 s_BatchData.TextureSlots[0] = s_BatchData.PlainTexture;
+                if(s_BatchData.Textures)
+                    s_BatchData.Textures->GetIndex(s_BatchData.PlainTexture);
 
-                //TODO: Create a Asset Manager to load shaders
-                s_BatchData.BatchShader = CreateShader("Renderer2D-GL-DefaultShaders", "Assets/Shaders/Renderer2D-Vertex.glsl", "Assets/Shaders/Renderer2D-Fragment.glsl");
-
-                s_BatchData.QuadVertexPositions[0] = { -0.5f, -0.5f, 0.0f, 1.0f };
-                s_BatchData.QuadVertexPositions[1] = {  0.5f, -0.5f, 0.0f, 1.0f };
-                s_BatchData.QuadVertexPositions[2] = {  0.5f,  0.5f, 0.0f, 1.0f };
-                s_BatchData.QuadVertexPositions[3] = { -0.5f,  0.5f, 0.0f, 1.0f };
+                s_BatchData.BatchShader = LoadShader("Renderer2D-GL-DefaultShaders", "Assets/Shaders/Renderer2D-Compact-Vertex.glsl", FragmentShaderPath("Renderer2D"), PLACEHOLDER_BATCH_VERTEX);
             }
         }
         s_BatchData.QuadVAO->Unbind();
+
+        if(!s_BatchData.InstanceStream)
+            s_BatchData.InstanceBuffer = new QuadInstance[MAX_QUADS];
+
+        s_BatchData.InstanceVAO = CreateVertexArray();
+        s_BatchData.InstanceVAO->Bind();
+        {
+            s_BatchData.InstanceVBO = s_BatchData.InstanceStream ? s_BatchData.InstanceStream : CreateVertexBuffer(MAX_QUADS * sizeof(QuadInstance));
+            s_BatchData.InstanceVBO->Bind();
+            {
+                s_BatchData.InstanceVBO->SetLayout({
+                    {"u_Position", BufferComponents::XYZ, BufferStride::F3, TE_FALSE, 1 },
+                    {"u_Size", BufferComponents::XY, BufferStride::F2, TE_FALSE, 1 },
+                    {"u_Rotation", BufferComponents::X, BufferStride::F1, TE_FALSE, 1 },
+                    {"u_Color", BufferComponents::RGBA, BufferStride::F4, TE_FALSE, 1 },
+                    {"u_TexRect", BufferComponents::XYZW, BufferStride::F4, TE_FALSE, 1 },
+                    {"u_TexIndex", BufferComponents::X, BufferStride::F1, TE_FALSE, 1 },
+                    {"u_TilingFactor", BufferComponents::X, BufferStride::F1, TE_FALSE, 1 }
+                });
+
+                s_BatchData.InstanceVAO->EmplaceVtxBuffer(s_BatchData.InstanceVBO);
+
+                UInt32 indices[QUAD_INDEX_COUNT] = { 0, 1, 2, 2, 3, 0 };
+                s_BatchData.InstanceIBO = CreateIndexBuffer(indices, QUAD_INDEX_COUNT);
+                s_BatchData.InstanceVAO->EmplaceIdxBuffer(s_BatchData.InstanceIBO);
+
+                s_BatchData.InstanceShader = LoadShader("Renderer2D-GL-InstancedShaders", "Assets/Shaders/Renderer2D-Instanced-Vertex.glsl", FragmentShaderPath("Renderer2D-Instanced"), PLACEHOLDER_INSTANCED_VERTEX);
+            }
+        }
+        s_BatchData.InstanceVAO->Unbind();
+
+        s_BatchData.BulkTextureIndices.resize(MAX_QUADS);
+
+        // Vertex pulling reads everything from storage, the empty VAO only satisfies the core profile.
+        // The packed quads are written straight into the stream ring when it is available.
+        s_BatchData.PulledStream = CreateStreamVertexBuffer(STREAM_FRAME_COUNT * MAX_QUADS * sizeof(PackedQuad));
+        if(!s_BatchData.PulledStream)
+        {
+            s_BatchData.PulledBuffer = new PackedQuad[MAX_QUADS];
+            s_BatchData.PulledSSBO = CreateStorageBuffer(MAX_QUADS * sizeof(PackedQuad));
+        }
+
+        s_BatchData.PulledVAO = CreateVertexArray();
+        s_BatchData.PulledShader = LoadShader("Renderer2D-GL-PulledShaders", "Assets/Shaders/Renderer2D-Pulling-Vertex.glsl", FragmentShaderPath("Renderer2D"), PLACEHOLDER_PULLED_VERTEX);
     }
+
     void Renderer2D::Shutdown()
     {
-        delete[] s_BatchData.QuadBuffer;
+        if(!s_BatchData.QuadStream)
+            delete[] s_BatchData.QuadBuffer;
+
+        if(!s_BatchData.InstanceStream)
+            delete[] s_BatchData.InstanceBuffer;
+
+        s_BatchData.BatchShader = nullptr;
+        s_BatchData.InstanceShader = nullptr;
+        s_BatchData.PulledShader = nullptr;
+        s_BatchData.Shaders.Clear();
+
+        if(!s_BatchData.PulledStream)
+            delete[] s_BatchData.PulledBuffer;
+
+        s_BatchData.PulledBuffer = nullptr;
+        s_BatchData.PulledSSBO = nullptr;
+        s_BatchData.PulledStream = nullptr;
+
+        s_BatchData.QuadStream = nullptr;
+        s_BatchData.InstanceStream = nullptr;
+        s_BatchData.Textures = nullptr;
+        s_BatchData.QuadVBO = nullptr;
+        s_BatchData.InstanceVBO = nullptr;
     }
 
-    void Renderer2D::Begin(const Camera2D& camera, const Mat4& transform)
+    void Renderer2D::EnableShaderHotReload()
     {
-        s_BatchData.BatchShader->Bind();
-        s_BatchData.BatchShader->SetUniform("u_MVP", camera.GetViewProjection());
+        s_BatchData.Shaders.EnableHotReload();
+    }
 
-        UInt32 texture_location = s_BatchData.BatchShader->GetUniformLocation("u_Textures");
-        Int32 samplers[MAX_TEXTURE_SLOTS];
-        for(UInt32 i = 0; i < MAX_TEXTURE_SLOTS; i++) 
-            samplers[i] = i;
+    ShaderLibrary& Renderer2D::GetShaderLibrary()
+    {
+        return s_BatchData.Shaders;
+    }
 
-        switch(Renderer::GetAPI())
-        {
-            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); break;
-            case RendererAPI::OpenGL:       glUniform1iv(texture_location, MAX_TEXTURE_SLOTS, samplers); break;
-            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); break;
-            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); break;
-            default:                        break;
-        };
+    Renderer2DMode Renderer2D::GetMode()
+    {
+        return s_BatchData.Mode;
+    }
 
-        s_BatchData.QuadBufferPtr = s_BatchData.QuadBuffer;
+    void Renderer2D::ChangeMode(Renderer2DMode mode)
+    {
+        if(s_BatchData.Mode == mode)
+            return;
+
+        SubmitDeferred();
+        if(s_BatchData.IndexCount || s_BatchData.InstanceCount)
+            Restart();
+
+        s_BatchData.Mode = mode;
+        s_BatchData.DeferredQuads.Reset(mode);
+        BindActiveShader();
+    }
+
+    void Renderer2D::EnableSorting(Boolean enable)
+    {
+        if(s_BatchData.Sorting == enable)
+            return;
+
+        SubmitDeferred();
+        s_BatchData.Sorting = enable;
+    }
+
+    Boolean Renderer2D::IsSortingEnabled()
+    {
+        return s_BatchData.Sorting;
+    }
+
+    void Renderer2D::SetSortLayer(UInt8 layer)
+    {
+        s_BatchData.SortLayer = layer;
+    }
+
+    void Renderer2D::SubmitDeferred()
+    {
+        if(!s_BatchData.Sorting || s_BatchData.SortKeys.empty())
+            return;
+
+        RadixSort(s_BatchData.SortKeys, s_BatchData.SortOrder, s_BatchData.SortKeysScratch, s_BatchData.SortOrderScratch);
+        Merge(s_BatchData.DeferredQuads, s_BatchData.SortOrder.data());
+
+        s_BatchData.DeferredQuads.Reset();
+        s_BatchData.SortKeys.clear();
+    }
+
+    void Renderer2D::Begin(const Camera2D& camera, const Mat4& transform)
+    {
+        CameraUniformBuffer::SetTime(static_cast<Float>(TE::Core::FrameStats::GetElapsedTime()));
+        s_BatchData.CameraSlot = CameraUniformBuffer::Push(camera.GetView(), camera.GetProjection(), camera.GetViewProjection());
+        CameraUniformBuffer::Bind(s_BatchData.CameraSlot);
+        s_BatchData.Shaders.Update();
+        BindActiveShader();
+        ReserveBatchBuffers();
+
+        s_BatchData.DeferredQuads.Reset();
+        s_BatchData.SortKeys.clear();
     }
 
     void Renderer2D::End()
     {
-        UInt32 size = (UInt8*)s_BatchData.QuadBufferPtr - (UInt8*)s_BatchData.QuadBuffer;
-        s_BatchData.QuadVBO->Bind();
-        s_BatchData.QuadVBO->SetData(s_BatchData.QuadBuffer, size);
-        Flush();
+        SubmitDeferred();
+        FlushBatch();
+
+        if(s_BatchData.QuadStream)
+            s_BatchData.QuadStream->Fence();
+
+        if(s_BatchData.InstanceStream)
+            s_BatchData.InstanceStream->Fence();
+
+        if(s_BatchData.PulledStream)
+            s_BatchData.PulledStream->Fence();
     }
 
     void Renderer2D::Flush()
     {
-        for(UInt32 i = 0; i < s_BatchData.TextureSlotIndex; i++) 
+        TE_PROFILE_FUNCTION();
+        TE_GPU_PROFILE_SCOPE("Renderer2D::Flush");
+        TE::Core::FrameStageScope submit_stage(TE::Core::FrameStage::Submit);
+
+        BindActiveShader();
+
+        if(s_BatchData.Textures)
         {
-            s_BatchData.TextureSlots[i]->Bind(i);
-		}
+            s_BatchData.Textures->Bind();
+        }
+        else
+        {
+            for(UInt32 i = 0; i < s_BatchData.TextureSlotIndex; i++) 
+                s_BatchData.TextureSlots[i]->Bind(i);
+        }
 
-        s_BatchData.QuadVAO->Bind();
+        switch(s_BatchData.Mode)
+        {
+            case Renderer2DMode::Instanced:         s_BatchData.InstanceVAO->Bind(); break;
+            case Renderer2DMode::VertexPulling:
+            {
+                s_BatchData.PulledVAO->Bind();
+                if(s_BatchData.PulledStream)
+                    s_BatchData.PulledStream->BindStorage(PULLED_QUAD_BINDING);
+                else
+                    s_BatchData.PulledSSBO->Bind(PULLED_QUAD_BINDING);
+                break;
+            }
+            default:                                s_BatchData.QuadVAO->Bind(); break;
+        }
 
         switch(Renderer::GetAPI())
         {
             case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); break;
-            case RendererAPI::OpenGL:       glDrawElements(GL_TRIANGLES, s_BatchData.IndexCount, GL_UNSIGNED_INT, nullptr); break;
+            case RendererAPI::OpenGL:
+            {
+                if(s_BatchData.Mode == Renderer2DMode::Instanced)
+                    glDrawElementsInstancedBaseInstance(GL_TRIANGLES, QUAD_INDEX_COUNT, GL_UNSIGNED_INT, nullptr, s_BatchData.InstanceCount, s_BatchData.BaseInstance);
+                else if(s_BatchData.Mode == Renderer2DMode::VertexPulling)
+                    glDrawArrays(GL_TRIANGLES, s_BatchData.BasePulledQuad * QUAD_INDEX_COUNT, s_BatchData.InstanceCount * QUAD_INDEX_COUNT);
+                else
+                    glDrawElementsBaseVertex(GL_TRIANGLES, s_BatchData.IndexCount, GL_UNSIGNED_INT, nullptr, s_BatchData.BaseVertex);
+                break;
+            }
             case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); break;
             case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); break;
             default:                        break;
@@ -156,9 +682,77 @@ namespace TE::Renderer
 
         s_BatchData.RenderingStatus.DrawCount++;
 		s_BatchData.IndexCount = 0;
+		s_BatchData.InstanceCount = 0;
 		s_BatchData.TextureSlotIndex = 1;
     }
 
+    Float Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture)
+    {
+        if(s_BatchData.Textures)
+            return static_cast<Float>(TableIndex(texture));
+
+        for(UInt32 i = 1; i < s_BatchData.TextureSlotIndex; i++) 
+        {
+			if (s_BatchData.TextureSlots[i] == texture) 
+				return static_cast<Float>(i);
+		}
+
+        Float texture_index = static_cast<Float>(s_BatchData.TextureSlotIndex);
+        s_BatchData.TextureSlots[s_BatchData.TextureSlotIndex] = texture;
+        s_BatchData.TextureSlotIndex++;
+        return texture_index;
+    }
+
+    void Renderer2D::EmplaceQuad(const Mat4& transform, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor)
+    {
+        if(s_BatchData.Sorting)
+        {
+            s_BatchData.SortKeys.emplace_back(MakeSortKey(transform[3].z, color.a, texture));
+            s_BatchData.DeferredQuads.Emplace(transform, color, texCoords, texture, tilingFactor);
+            return;
+        }
+
+        if (s_BatchData.IndexCount >= MAX_INDICES || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) 
+        {
+            Restart();
+        }
+
+        WriteQuadVertices(s_BatchData.QuadBufferPtr, transform, color, texCoords, GetTextureIndex(texture), tilingFactor);
+        s_BatchData.QuadBufferPtr += MAX_QUAD_VERTEX_COUNT;
+
+		s_BatchData.IndexCount += QUAD_INDEX_COUNT;
+		s_BatchData.RenderingStatus.QuadCount++;
+    }
+
+    void Renderer2D::EmplaceInstance(const Vec3& position, const Vec2& size, Float rotation, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor)
+    {
+        if(s_BatchData.Sorting)
+        {
+            s_BatchData.SortKeys.emplace_back(MakeSortKey(position.z, color.a, texture));
+            s_BatchData.DeferredQuads.Emplace(position, size, rotation, color, texCoords, texture, tilingFactor);
+            return;
+        }
+
+        if (s_BatchData.InstanceCount >= MAX_QUADS || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) 
+        {
+            Restart();
+        }
+
+        if(s_BatchData.Mode == Renderer2DMode::VertexPulling)
+        {
+            WritePackedQuad(s_BatchData.PulledBufferPtr, position, size, rotation, color, { texCoords[0].x, texCoords[0].y, texCoords[2].x, texCoords[2].y }, GetTextureIndex(texture), tilingFactor);
+            s_BatchData.PulledBufferPtr++;
+        }
+        else
+        {
+            WriteQuadInstance(s_BatchData.InstanceBufferPtr, position, size, rotation, color, texCoords, GetTextureIndex(texture), tilingFactor);
+            s_BatchData.InstanceBufferPtr++;
+        }
+
+        s_BatchData.InstanceCount++;
+        s_BatchData.RenderingStatus.QuadCount++;
+    }
+
     void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color)
     {
         DrawQuad(position, size, color, s_BatchData.PlainTexture, 0.0f, 1.0f);
@@ -186,166 +780,255 @@ namespace TE::Renderer
 
     void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<Texture2D>& texture, Float rotation, Float tilingFactor)
     {
-        if (s_BatchData.IndexCount >= MAX_INDICES || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) 
+        if(s_BatchData.Mode != Renderer2DMode::Batch)
         {
-            Restart();
+            EmplaceInstance({ position.x, position.y, 0.0f }, size, rotation, color, DEFAULT_TEX_COORDS, texture, tilingFactor);
+            return;
         }
 
-        Float texture_index = 0.0f;
-        for(UInt32 i = 1; i < s_BatchData.TextureSlotIndex; i++) 
-        {
-			if (s_BatchData.TextureSlots[i] == texture) 
-            {
-				texture_index = static_cast<Float>(i);
-				break;
-			}
-		}
+        EmplaceQuad(QuadTransform({ position.x, position.y, 0.0f }, size, rotation), color, DEFAULT_TEX_COORDS, texture, tilingFactor);
+    }
 
-        if(texture_index == 0.0f) 
+    void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, const glm::vec4& color, const Ref<SubTexture2D>& texture, Float rotation, Float tilingFactor)
+    {
+        if(s_BatchData.Mode != Renderer2DMode::Batch)
         {
-			texture_index = static_cast<Float>(s_BatchData.TextureSlotIndex);
-			s_BatchData.TextureSlots[s_BatchData.TextureSlotIndex] = texture;
-			s_BatchData.TextureSlotIndex++;
-		}
+            EmplaceInstance({ position.x, position.y, 0.0f }, size, rotation, color, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+            return;
+        }
 
-        Mat4 transform = glm::translate(Mat4(1.0f), { position.x, position.y, 0.0f }) * glm::rotate(Mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f }) * glm::scale(Mat4(1.0f), { size.x, size.y, 1.0f });
+        EmplaceQuad(QuadTransform({ position.x, position.y, 0.0f }, size, rotation), color, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+    }
 
-		for(UInt32 i = 0; i < MAX_QUAD_VERTEX_COUNT; i++) 
+    void Renderer2D::DrawQuad(const Mat4& transform, const Vec4& color)
+    {
+        DrawQuad(transform, s_BatchData.PlainTexture, color, 1.0f);
+    }
+
+    void Renderer2D::DrawQuad(const Mat4 & transform, const Ref<Texture2D>& texture, const Vec4 & tint, Float tilingFactor)
+    {
+        if(s_BatchData.Mode != Renderer2DMode::Batch)
         {
-			s_BatchData.QuadBufferPtr->Position             = transform * s_BatchData.QuadVertexPositions[i];
-			s_BatchData.QuadBufferPtr->Color                = color;
-			s_BatchData.QuadBufferPtr->TexCoords            = DEFAULT_TEX_COORDS[i];
-			s_BatchData.QuadBufferPtr->TexIndex             = texture_index;
-			s_BatchData.QuadBufferPtr->TilingFactor         = tilingFactor;
-			s_BatchData.QuadBufferPtr++;
-		}
+            Vec3 position; Vec2 size; Float rotation;
+            DecomposeTransform(transform, position, size, rotation);
+            EmplaceInstance(position, size, rotation, tint, DEFAULT_TEX_COORDS, texture, tilingFactor);
+            return;
+        }
 
-		s_BatchData.IndexCount += 6;
-		s_BatchData.RenderingStatus.QuadCount++;
+        EmplaceQuad(transform, tint, DEFAULT_TEX_COORDS, texture, tilingFactor);
     }
 
-    void Renderer2D::DrawQuad(const Vec2& position, const Vec2& size, const glm::vec4& color, const Ref<SubTexture2D>& texture, Float rotation, Float tilingFactor)
+    void Renderer2D::DrawQuad(const Mat4& transform, const Ref<SubTexture2D>& texture, const Vec4& tint, Float tilingFactor)
     {
-        if (s_BatchData.IndexCount >= MAX_INDICES || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) 
+        if(s_BatchData.Mode != Renderer2DMode::Batch)
         {
-			Restart();
-		}
+            Vec3 position; Vec2 size; Float rotation;
+            DecomposeTransform(transform, position, size, rotation);
+            EmplaceInstance(position, size, rotation, tint, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+            return;
+        }
 
-        const Vec2* tex_coords = texture->GetTextureCoords();
-        Float texture_index = 0.0f;
+        EmplaceQuad(transform, tint, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+    }
 
-        for (UInt32 i = 1; i < s_BatchData.TextureSlotIndex; i++) 
+    void Renderer2D::DrawQuads(std::span<const QuadDesc> quads)
+    {
+        if(s_BatchData.Mode != Renderer2DMode::Batch || s_BatchData.Sorting)
         {
-            if (s_BatchData.TextureSlots[i] == texture->GetTexturePtr()) {
-                texture_index = static_cast<Float>(i);
-                break;
+            for(const QuadDesc& quad : quads)
+            {
+                const Ref<Texture2D>& texture = quad.Texture ? quad.Texture : s_BatchData.PlainTexture;
+                if(s_BatchData.Mode == Renderer2DMode::Batch)
+                    EmplaceQuad(QuadTransform(quad.Position, quad.Size, quad.Rotation), quad.Color, DEFAULT_TEX_COORDS, texture, quad.TilingFactor);
+                else
+                    EmplaceInstance(quad.Position, quad.Size, quad.Rotation, quad.Color, DEFAULT_TEX_COORDS, texture, quad.TilingFactor);
             }
+            return;
         }
 
-        if(texture_index == 0.0f) 
+        const UInt32 count = static_cast<UInt32>(quads.size());
+        UInt32 offset = 0;
+        while(offset < count)
         {
-			texture_index = static_cast<Float>(s_BatchData.TextureSlotIndex);
-			s_BatchData.TextureSlots[s_BatchData.TextureSlotIndex] = texture->GetTexturePtr();
-			s_BatchData.TextureSlotIndex++;
-		}
+            // Texture slots are resolved up front so a chunk never spans a batch restart.
+            const UInt32 capacity = std::min((MAX_INDICES - s_BatchData.IndexCount) / QUAD_INDEX_COUNT, count - offset);
+            UInt32 chunk = 0;
+            while(chunk < capacity && s_BatchData.TextureSlotIndex < MAX_TEXTURE_SLOTS)
+            {
+                const QuadDesc& quad = quads[offset + chunk];
+                s_BatchData.BulkTextureIndices[chunk] = static_cast<UInt32>(GetTextureIndex(quad.Texture ? quad.Texture : s_BatchData.PlainTexture));
+                chunk++;
+            }
 
-        Mat4 transform = glm::translate(Mat4(1.0f), { position.x, position.y, 0.0f }) * glm::rotate(Mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f }) * glm::scale(Mat4(1.0f), { size.x, size.y, 1.0f });
+            if(chunk == 0)
+            {
+                Restart();
+                continue;
+            }
 
-		for (UInt32 i = 0; i < MAX_QUAD_VERTEX_COUNT; i++) 
-        {
-			s_BatchData.QuadBufferPtr->Position         = transform * s_BatchData.QuadVertexPositions[i];
-			s_BatchData.QuadBufferPtr->Color            = color;
-			s_BatchData.QuadBufferPtr->TexCoords        = tex_coords[i];
-			s_BatchData.QuadBufferPtr->TexIndex         = texture_index;
-			s_BatchData.QuadBufferPtr->TilingFactor     = tilingFactor;
-			s_BatchData.QuadBufferPtr++;
-		}
+            QuadVertex* vertices = s_BatchData.QuadBufferPtr;
+            WriteQuadCorners(&quads[offset], chunk, &vertices->Position, sizeof(QuadVertex));
 
-		s_BatchData.IndexCount += 6;
-		s_BatchData.RenderingStatus.QuadCount++;
-    }
+            for(UInt32 i = 0; i < chunk; i++)
+            {
+                const QuadDesc& quad = quads[offset + i];
+                const UInt32 packed_color = glm::packUnorm4x8(quad.Color);
+                const UInt32 depth_tex_index = PackDepthTexIndex(quad.Position.z, s_BatchData.BulkTextureIndices[i]);
+                for(UInt32 v = 0; v < MAX_QUAD_VERTEX_COUNT; v++, vertices++)
+                {
+                    vertices->Color             = packed_color;
+                    vertices->TexCoords         = glm::packHalf2x16(DEFAULT_TEX_COORDS[v] * quad.TilingFactor);
+                    vertices->DepthTexIndex     = depth_tex_index;
+                }
+            }
 
-    void Renderer2D::DrawQuad(const Mat4& transform, const Vec4& color)
-    {
-        DrawQuad(transform, s_BatchData.PlainTexture, color, 1.0f);
+            s_BatchData.QuadBufferPtr = vertices;
+            s_BatchData.IndexCount += chunk * QUAD_INDEX_COUNT;
+            s_BatchData.RenderingStatus.QuadCount += chunk;
+            offset += chunk;
+        }
     }
 
-    void Renderer2D::DrawQuad(const Mat4 & transform, const Ref<Texture2D>& texture, const Vec4 & tint, Float tilingFactor)
+    void Renderer2D::DrawStaticBatch(StaticBatch& batch)
     {
-        if (s_BatchData.IndexCount >= MAX_INDICES || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) {
+        if(!batch.m_QuadCount)
+            return;
+
+        SubmitDeferred();
+        if(s_BatchData.IndexCount || s_BatchData.InstanceCount)
             Restart();
-        }
 
-        Float texture_index = 0.0f;
-        for (uint32_t i = 1; i < s_BatchData.TextureSlotIndex; i++) 
+        batch.ResolveTableIndices();
+        batch.Upload();
+
+        s_BatchData.Shaders.Get(s_BatchData.BatchShader->GetName())->Bind();
+
+        if(s_BatchData.Textures)
         {
-            if (s_BatchData.TextureSlots[i] == texture) 
-            {
-                texture_index = static_cast<Float>(i);
-                break;
-            }
+            s_BatchData.Textures->Bind();
         }
-
-        if (texture_index == 0.0f) 
+        else
         {
-            texture_index = static_cast<Float>(s_BatchData.TextureSlotIndex);
-            s_BatchData.TextureSlots[s_BatchData.TextureSlotIndex] = texture;
-            s_BatchData.TextureSlotIndex++;
+            for(UInt32 i = 0; i < batch.m_Textures.size(); i++)
+                batch.m_Textures[i]->Bind(i);
         }
 
-        for (UInt32 i = 0; i < MAX_QUAD_VERTEX_COUNT; i++) 
+        batch.m_VAO->Bind();
+        switch(Renderer::GetAPI())
         {
-            s_BatchData.QuadBufferPtr->Position         = transform * s_BatchData.QuadVertexPositions[i];
-            s_BatchData.QuadBufferPtr->Color            = tint;
-            s_BatchData.QuadBufferPtr->TexCoords        = DEFAULT_TEX_COORDS[i];
-            s_BatchData.QuadBufferPtr->TexIndex         = texture_index;
-            s_BatchData.QuadBufferPtr->TilingFactor     = tilingFactor;
-            s_BatchData.QuadBufferPtr++;
-        }
+            case RendererAPI::None:         TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); break;
+            case RendererAPI::OpenGL:       glDrawElements(GL_TRIANGLES, batch.m_QuadCount * QUAD_INDEX_COUNT, GL_UNSIGNED_INT, nullptr); break;
+            case RendererAPI::Vulkan:       TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); break;
+            case RendererAPI::DirectX:      TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); break;
+            default:                        break;
+        };
 
-        s_BatchData.IndexCount += 6;
-        s_BatchData.RenderingStatus.QuadCount++;
+        BindActiveShader();
+
+        s_BatchData.RenderingStatus.DrawCount++;
+        s_BatchData.RenderingStatus.QuadCount += batch.m_QuadCount;
     }
 
-    void Renderer2D::DrawQuad(const Mat4& transform, const Ref<SubTexture2D>& texture, const Vec4& tint, Float tilingFactor)
+    void Renderer2D::Submit(const Renderer2DRecorder& recorder)
     {
-        if (s_BatchData.IndexCount >= MAX_INDICES || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) 
+        if(!s_BatchData.Sorting)
         {
-            Restart();
+            Merge(recorder, nullptr);
+            return;
         }
 
-        const glm::vec2* tex_coords = texture->GetTextureCoords();
-        float texture_index = 0.0f;
+        TRIMANA_ASSERT(recorder.GetMode() == s_BatchData.Mode, "Recorder was filled for a different Renderer2D mode");
+        if(recorder.GetMode() != s_BatchData.Mode)
+            return;
 
-        for (uint32_t i = 1; i < s_BatchData.TextureSlotIndex; i++) 
+        // Keys use the current sort layer, the same as quads drawn directly at this point.
+        const UInt32 quad_count = recorder.GetQuadCount();
+        s_BatchData.SortKeys.reserve(s_BatchData.SortKeys.size() + quad_count);
+        for(UInt32 i = 0; i < quad_count; i++)
         {
-            if (s_BatchData.TextureSlots[i] == texture->GetTexturePtr()) 
+            const Ref<Texture2D>& texture = recorder.m_Textures[recorder.m_QuadTextures[i]];
+            if(s_BatchData.Mode == Renderer2DMode::Batch)
             {
-                texture_index = static_cast<float>(i);
-                break;
+                const QuadVertex& vertex = recorder.m_Vertices[i * MAX_QUAD_VERTEX_COUNT];
+                s_BatchData.SortKeys.emplace_back(MakeSortKey(glm::unpackHalf1x16(static_cast<UInt16>(vertex.DepthTexIndex >> 16)), glm::unpackUnorm4x8(vertex.Color).a, texture));
+            }
+            else
+            {
+                const QuadInstance& instance = recorder.m_Instances[i];
+                s_BatchData.SortKeys.emplace_back(MakeSortKey(instance.Position.z, instance.Color.a, texture));
             }
         }
 
-        if (texture_index == 0.0f) 
+        s_BatchData.DeferredQuads.Append(recorder);
+    }
+
+    void Renderer2D::Merge(const Renderer2DRecorder& recorder, const UInt32* order)
+    {
+        TRIMANA_ASSERT(recorder.GetMode() == s_BatchData.Mode, "Recorder was filled for a different Renderer2D mode");
+        if(recorder.GetMode() != s_BatchData.Mode)
+            return;
+
+        const UInt32 quad_count = recorder.GetQuadCount();
+        const Boolean instanced = (s_BatchData.Mode != Renderer2DMode::Batch);
+
+        // Batch slots are resolved once per recorder texture; a restart hands out fresh slots, so the
+        // remap is dropped whenever one happens mid-merge.
+        std::vector<UInt32>& slots = s_BatchData.MergeTextureSlots;
+        slots.assign(recorder.m_Textures.size(), UNMAPPED_TEXTURE_SLOT);
+        auto texture_slot = [&](UInt32 texture)
         {
-            texture_index = static_cast<float>(s_BatchData.TextureSlotIndex);
-            s_BatchData.TextureSlots[s_BatchData.TextureSlotIndex] = texture->GetTexturePtr();
-            s_BatchData.TextureSlotIndex++;
-        }
+            if(slots[texture] == UNMAPPED_TEXTURE_SLOT)
+                slots[texture] = static_cast<UInt32>(GetTextureIndex(recorder.m_Textures[texture]));
 
+            return slots[texture];
+        };
 
-        for (uint32_t i = 0; i < MAX_QUAD_VERTEX_COUNT; i++) 
+        for(UInt32 n = 0; n < quad_count; n++)
         {
-            s_BatchData.QuadBufferPtr->Position             = transform * s_BatchData.QuadVertexPositions[i];
-            s_BatchData.QuadBufferPtr->Color                = tint;
-            s_BatchData.QuadBufferPtr->TexCoords            = tex_coords[i];
-            s_BatchData.QuadBufferPtr->TexIndex             = texture_index;
-            s_BatchData.QuadBufferPtr->TilingFactor         = tilingFactor;
-            s_BatchData.QuadBufferPtr++;
+            const UInt32 i = order ? order[n] : n;
+            const UInt32 texture = recorder.m_QuadTextures[i];
+            if(instanced)
+            {
+                if (s_BatchData.InstanceCount >= MAX_QUADS || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS) 
+                {
+                    Restart();
+                    std::fill(slots.begin(), slots.end(), UNMAPPED_TEXTURE_SLOT);
+                }
+
+                const QuadInstance& instance = recorder.m_Instances[i];
+                if(s_BatchData.Mode == Renderer2DMode::VertexPulling)
+                {
+                    WritePackedQuad(s_BatchData.PulledBufferPtr, instance.Position, instance.Size, instance.Rotation, instance.Color, instance.TexRect, static_cast<Float>(texture_slot(texture)), instance.TilingFactor);
+                    s_BatchData.PulledBufferPtr++;
+                }
+                else
+                {
+                    *s_BatchData.InstanceBufferPtr = instance;
+                    s_BatchData.InstanceBufferPtr->TexIndex = static_cast<Float>(texture_slot(texture));
+                    s_BatchData.InstanceBufferPtr++;
+                }
+                s_BatchData.InstanceCount++;
+            }
+            else
+            {
+                if (s_BatchData.IndexCount >= MAX_INDICES || s_BatchData.TextureSlotIndex >= MAX_TEXTURE_SLOTS)
+                {
+                    Restart();
+                    std::fill(slots.begin(), slots.end(), UNMAPPED_TEXTURE_SLOT);
+                }
+
+                UInt32 texture_index = texture_slot(texture);
+                TRIMANA_ASSERT(texture_index <= MAX_PACKED_TEXTURE_INDEX, "Texture index does not fit the packed vertex format");
+                std::memcpy(s_BatchData.QuadBufferPtr, &recorder.m_Vertices[i * MAX_QUAD_VERTEX_COUNT], MAX_QUAD_VERTEX_COUNT * sizeof(QuadVertex));
+                for(UInt32 v = 0; v < MAX_QUAD_VERTEX_COUNT; v++)
+                    s_BatchData.QuadBufferPtr[v].DepthTexIndex = (s_BatchData.QuadBufferPtr[v].DepthTexIndex & ~MAX_PACKED_TEXTURE_INDEX) | texture_index;
+
+                s_BatchData.QuadBufferPtr += MAX_QUAD_VERTEX_COUNT;
+                s_BatchData.IndexCount += QUAD_INDEX_COUNT;
+            }
         }
 
-        s_BatchData.IndexCount += 6;
-        s_BatchData.RenderingStatus.QuadCount++;
+        s_BatchData.RenderingStatus.QuadCount += quad_count;
     }
 
     const Renderer2D::Status& Renderer2D::RenderingStatus()
@@ -355,7 +1038,283 @@ namespace TE::Renderer
 
     void Renderer2D::StatusReset()
     {
+        TE_PROFILE_COUNTER("Renderer2D Quads", s_BatchData.RenderingStatus.QuadCount);
+        TE_PROFILE_COUNTER("Renderer2D Draw Calls", s_BatchData.RenderingStatus.DrawCount);
         s_BatchData.RenderingStatus.DrawCount = TE_NULL;
         s_BatchData.RenderingStatus.QuadCount = TE_NULL;
     }
-}
\ No newline at end of file
+
+    void Renderer2DRecorder::Reset()
+    {
+        m_Vertices.clear();
+        m_Instances.clear();
+        m_Textures.clear();
+        m_TextureIndices.clear();
+        m_QuadTextures.clear();
+    }
+
+    void Renderer2DRecorder::Reset(Renderer2DMode mode)
+    {
+        m_Mode = mode;
+        Reset();
+    }
+
+    void Renderer2DRecorder::Reserve(UInt32 quadCount)
+    {
+        (m_Mode != Renderer2DMode::Batch) ? m_Instances.reserve(quadCount) : m_Vertices.reserve(quadCount * MAX_QUAD_VERTEX_COUNT);
+        m_QuadTextures.reserve(quadCount);
+    }
+
+    void Renderer2DRecorder::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, Float rotation)
+    {
+        Emplace({ position.x, position.y, 0.0f }, size, rotation, color, DEFAULT_TEX_COORDS, s_BatchData.PlainTexture, 1.0f);
+    }
+
+    void Renderer2DRecorder::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<Texture2D>& texture, Float rotation, Float tilingFactor)
+    {
+        Emplace({ position.x, position.y, 0.0f }, size, rotation, color, DEFAULT_TEX_COORDS, texture, tilingFactor);
+    }
+
+    void Renderer2DRecorder::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<SubTexture2D>& texture, Float rotation, Float tilingFactor)
+    {
+        Emplace({ position.x, position.y, 0.0f }, size, rotation, color, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+    }
+
+    void Renderer2DRecorder::DrawQuad(const Mat4& transform, const Vec4& color)
+    {
+        Emplace(transform, color, DEFAULT_TEX_COORDS, s_BatchData.PlainTexture, 1.0f);
+    }
+
+    void Renderer2DRecorder::DrawQuad(const Mat4& transform, const Ref<Texture2D>& texture, const Vec4& tint, Float tilingFactor)
+    {
+        Emplace(transform, tint, DEFAULT_TEX_COORDS, texture, tilingFactor);
+    }
+
+    void Renderer2DRecorder::DrawQuad(const Mat4& transform, const Ref<SubTexture2D>& texture, const Vec4& tint, Float tilingFactor)
+    {
+        Emplace(transform, tint, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+    }
+
+    UInt32 Renderer2DRecorder::GetTextureIndex(const Ref<Texture2D>& texture)
+    {
+        auto it = m_TextureIndices.find(texture.get());
+        if(it != m_TextureIndices.end())
+            return it->second;
+
+        UInt32 texture_index = static_cast<UInt32>(m_Textures.size());
+        m_Textures.emplace_back(texture);
+        m_TextureIndices[texture.get()] = texture_index;
+        return texture_index;
+    }
+
+    void Renderer2DRecorder::Emplace(const Vec3& position, const Vec2& size, Float rotation, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor)
+    {
+        if(m_Mode != Renderer2DMode::Batch)
+        {
+            m_Instances.emplace_back();
+            WriteQuadInstance(&m_Instances.back(), position, size, rotation, color, texCoords, 0.0f, tilingFactor);
+            m_QuadTextures.emplace_back(GetTextureIndex(texture));
+            return;
+        }
+
+        Emplace(QuadTransform(position, size, rotation), color, texCoords, texture, tilingFactor);
+    }
+
+    void Renderer2DRecorder::Emplace(const Mat4& transform, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor)
+    {
+        if(m_Mode != Renderer2DMode::Batch)
+        {
+            Vec3 position; Vec2 size; Float rotation;
+            DecomposeTransform(transform, position, size, rotation);
+            m_Instances.emplace_back();
+            WriteQuadInstance(&m_Instances.back(), position, size, rotation, color, texCoords, 0.0f, tilingFactor);
+            m_QuadTextures.emplace_back(GetTextureIndex(texture));
+            return;
+        }
+
+        m_Vertices.resize(m_Vertices.size() + MAX_QUAD_VERTEX_COUNT);
+        WriteQuadVertices(&m_Vertices[m_Vertices.size() - MAX_QUAD_VERTEX_COUNT], transform, color, texCoords, 0.0f, tilingFactor);
+        m_QuadTextures.emplace_back(GetTextureIndex(texture));
+    }
+
+    void Renderer2DRecorder::Append(const Renderer2DRecorder& recorder)
+    {
+        m_Vertices.insert(m_Vertices.end(), recorder.m_Vertices.begin(), recorder.m_Vertices.end());
+        m_Instances.insert(m_Instances.end(), recorder.m_Instances.begin(), recorder.m_Instances.end());
+
+        std::vector<UInt32> remap(recorder.m_Textures.size());
+        for(UInt32 i = 0; i < recorder.m_Textures.size(); i++)
+            remap[i] = GetTextureIndex(recorder.m_Textures[i]);
+
+        m_QuadTextures.reserve(m_QuadTextures.size() + recorder.m_QuadTextures.size());
+        for(UInt32 texture : recorder.m_QuadTextures)
+            m_QuadTextures.emplace_back(remap[texture]);
+    }
+
+    StaticBatch::StaticBatch(UInt32 maxQuads) : m_MaxQuads(maxQuads)
+    {
+        TRIMANA_ASSERT(maxQuads <= MAX_QUADS, "Static batch is larger than the shared quad index buffer");
+        m_MaxQuads = std::min(maxQuads, MAX_QUADS);
+        m_Vertices.reserve(m_MaxQuads * MAX_QUAD_VERTEX_COUNT);
+        Clear();
+
+        m_VAO = CreateVertexArray();
+        m_VAO->Bind();
+        {
+            m_VBO = CreateVertexBuffer(m_MaxQuads * MAX_QUAD_VERTEX_COUNT * sizeof(QuadVertex));
+            m_VBO->Bind();
+            m_VBO->SetLayout(QuadVertexLayout());
+
+            m_VAO->EmplaceVtxBuffer(m_VBO);
+            m_VAO->EmplaceIdxBuffer(s_BatchData.QuadIBO);
+        }
+        m_VAO->Unbind();
+    }
+
+    UInt32 StaticBatch::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, Float rotation)
+    {
+        return DrawQuad(position, size, color, s_BatchData.PlainTexture, rotation, 1.0f);
+    }
+
+    UInt32 StaticBatch::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<Texture2D>& texture, Float rotation, Float tilingFactor)
+    {
+        TRIMANA_ASSERT(m_QuadCount < m_MaxQuads, "Static batch is full");
+        Write(m_QuadCount, QuadTransform({ position.x, position.y, 0.0f }, size, rotation), color, DEFAULT_TEX_COORDS, texture, tilingFactor);
+        return m_QuadCount++;
+    }
+
+    UInt32 StaticBatch::DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<SubTexture2D>& texture, Float rotation, Float tilingFactor)
+    {
+        TRIMANA_ASSERT(m_QuadCount < m_MaxQuads, "Static batch is full");
+        Write(m_QuadCount, QuadTransform({ position.x, position.y, 0.0f }, size, rotation), color, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+        return m_QuadCount++;
+    }
+
+    UInt32 StaticBatch::DrawQuad(const Mat4& transform, const Ref<Texture2D>& texture, const Vec4& tint, Float tilingFactor)
+    {
+        TRIMANA_ASSERT(m_QuadCount < m_MaxQuads, "Static batch is full");
+        Write(m_QuadCount, transform, tint, DEFAULT_TEX_COORDS, texture, tilingFactor);
+        return m_QuadCount++;
+    }
+
+    void StaticBatch::SetQuad(UInt32 index, const Mat4& transform, const Vec4& color, const Ref<Texture2D>& texture, Float tilingFactor)
+    {
+        TRIMANA_ASSERT(index < m_QuadCount, "Static batch quad index out of range");
+        Write(index, transform, color, DEFAULT_TEX_COORDS, texture, tilingFactor);
+    }
+
+    void StaticBatch::SetQuad(UInt32 index, const Mat4& transform, const Vec4& color, const Ref<SubTexture2D>& texture, Float tilingFactor)
+    {
+        TRIMANA_ASSERT(index < m_QuadCount, "Static batch quad index out of range");
+        Write(index, transform, color, texture->GetTextureCoords(), texture->GetTexturePtr(), tilingFactor);
+    }
+
+    void StaticBatch::Clear()
+    {
+        m_QuadCount = TE_NULL;
+        m_DirtyBegin = TE_NULL;
+        m_DirtyEnd = TE_NULL;
+        m_Vertices.clear();
+        m_QuadTextures.clear();
+        m_Textures.clear();
+        m_TableIndices.clear();
+        GetTextureSlot(s_BatchData.PlainTexture);
+    }
+
+    void StaticBatch::Upload()
+    {
+        if(!IsDirty())
+            return;
+
+        const UInt32 vertex_begin = m_DirtyBegin * MAX_QUAD_VERTEX_COUNT;
+        const UInt32 vertex_count = (m_DirtyEnd - m_DirtyBegin) * MAX_QUAD_VERTEX_COUNT;
+        m_VBO->SetData(&m_Vertices[vertex_begin], vertex_count * sizeof(QuadVertex), vertex_begin * sizeof(QuadVertex));
+
+        m_DirtyBegin = TE_NULL;
+        m_DirtyEnd = TE_NULL;
+    }
+
+    // In table mode the batch holds its textures as well: the table only keeps weak references, and a
+    // texture nothing else owns would otherwise give up the layer or handle the baked vertices point at.
+    UInt32 StaticBatch::GetTextureSlot(const Ref<Texture2D>& texture)
+    {
+        for(UInt32 i = 0; i < m_Textures.size(); i++)
+        {
+            if(m_Textures[i] == texture)
+                return i;
+        }
+
+        if(s_BatchData.Textures)
+        {
+            m_Textures.emplace_back(texture);
+            m_TableIndices.emplace_back(TableIndex(texture));
+            return static_cast<UInt32>(m_Textures.size() - 1);
+        }
+
+        if(m_Textures.size() >= MAX_TEXTURE_SLOTS)
+        {
+            TE_CORE_WARN("Static batch ran out of texture slots, falling back to the plain texture");
+            return TE_NULL;
+        }
+
+        m_Textures.emplace_back(texture);
+        return static_cast<UInt32>(m_Textures.size() - 1);
+    }
+
+    void StaticBatch::Write(UInt32 index, const Mat4& transform, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor)
+    {
+        if(index >= m_QuadTextures.size())
+        {
+            m_Vertices.resize((index + 1) * MAX_QUAD_VERTEX_COUNT);
+            m_QuadTextures.resize(index + 1);
+        }
+
+        UInt32 slot = GetTextureSlot(texture);
+        UInt32 texture_index = s_BatchData.Textures ? m_TableIndices[slot] : slot;
+        m_QuadTextures[index] = slot;
+
+        WriteQuadVertices(&m_Vertices[index * MAX_QUAD_VERTEX_COUNT], transform, color, texCoords, static_cast<Float>(texture_index), tilingFactor);
+
+        m_DirtyBegin = IsDirty() ? std::min(m_DirtyBegin, index) : index;
+        m_DirtyEnd = std::max(m_DirtyEnd, index + 1);
+    }
+
+    // Table indices are baked into the vertices. A texture that finishes streaming in moves off its
+    // placeholder, and a new revision can move it to another array layer, so every texture is looked up
+    // again before drawing and the quads whose index changed are re-pointed.
+    void StaticBatch::ResolveTableIndices()
+    {
+        if(!s_BatchData.Textures)
+            return;
+
+        std::vector<Boolean> changed(m_Textures.size(), TE_FALSE);
+        Boolean any_changed = TE_FALSE;
+        for(UInt32 i = 0; i < m_Textures.size(); i++)
+        {
+            UInt32 texture_index = TableIndex(m_Textures[i]);
+            if(texture_index == m_TableIndices[i])
+                continue;
+
+            m_TableIndices[i] = texture_index;
+            changed[i] = TE_TRUE;
+            any_changed = TE_TRUE;
+        }
+
+        if(!any_changed)
+            return;
+
+        for(UInt32 quad = 0; quad < m_QuadCount; quad++)
+        {
+            UInt32 slot = m_QuadTextures[quad];
+            if(!changed[slot])
+                continue;
+
+            QuadVertex* vertices = &m_Vertices[quad * MAX_QUAD_VERTEX_COUNT];
+            for(UInt32 i = 0; i < MAX_QUAD_VERTEX_COUNT; i++)
+                vertices[i].DepthTexIndex = (vertices[i].DepthTexIndex & ~MAX_PACKED_TEXTURE_INDEX) | (m_TableIndices[slot] & MAX_PACKED_TEXTURE_INDEX);
+
+            m_DirtyBegin = IsDirty() ? std::min(m_DirtyBegin, quad) : quad;
+            m_DirtyEnd = std::max(m_DirtyEnd, quad + 1);
+        }
+    }
+}
@@ -1,12 +1,19 @@
 #pragma once
 
 #include <array>
+#include <span>
+#include <vector>
+#include <unordered_map>
 
 #include "TypeDef.hpp"
 #include "VertexArray.hpp"
 #include "Buffers.hpp"
 #include "Texture2D.hpp"
+#include "TextureTable.hpp"
+#include "QuadKernel.hpp"
+#include "CameraUniformBuffer.hpp"
 #include "Shaders.hpp"
+#include "ShaderLibrary.hpp"
 #include "Camera2D.hpp"
 #include "Renderer.hpp"
 
@@ -14,6 +21,51 @@
 
 namespace TE::Renderer
 {
+    enum class Renderer2DMode
+    {
+        Batch           = 0,
+        Instanced       = 1,
+        VertexPulling   = 2
+    };
+
+    // 20 bytes: RGBA8 colour, half2 texture coordinates pre-multiplied by the tiling factor,
+    // and half-float depth in the upper 16 bits of DepthTexIndex with the texture index below it.
+    struct QuadVertex 
+    {
+		Vec2 Position;
+		UInt32 Color;
+		UInt32 TexCoords;
+		UInt32 DepthTexIndex;
+	};
+
+    // One record per quad, expanded to four corners by Renderer2D-Instanced-Vertex.glsl.
+    struct QuadInstance
+    {
+        Vec3 Position;
+        Vec2 Size;
+        Float Rotation;
+        Vec4 Color;
+        Vec4 TexRect;
+        Float TexIndex;
+        Float TilingFactor;
+    };
+
+    // std430 record read by Renderer2D-Pulling-Vertex.glsl; colour is RGBA8 and the texture rect is half2 min/max.
+    struct PackedQuad
+    {
+        Vec3 Position;
+        Float Rotation;
+        Vec2 Size;
+        UInt32 Color;
+        UInt32 TexIndex;
+        UInt32 TexRect[2];
+        Float TilingFactor;
+        Float Padding;
+    };
+
+    class Renderer2DRecorder;
+    class StaticBatch;
+
     class Renderer2D
     {
         private:
@@ -21,14 +73,30 @@ namespace TE::Renderer
             ~Renderer2D() = default;
 
             static void Restart();
+            static void Merge(const Renderer2DRecorder& recorder, const UInt32* order);
+            static void SubmitDeferred();
+            static Float GetTextureIndex(const Ref<Texture2D>& texture);
+            static void EmplaceQuad(const Mat4& transform, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor);
+            static void EmplaceInstance(const Vec3& position, const Vec2& size, Float rotation, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor);
 
         public:
             static void Init();
             static void Shutdown();
 
+            static void EnableShaderHotReload();
+            static ShaderLibrary& GetShaderLibrary();
+
+            static Renderer2DMode GetMode();
+            static void ChangeMode(Renderer2DMode mode);
+
+            static void EnableSorting(Boolean enable);
+            static Boolean IsSortingEnabled();
+            static void SetSortLayer(UInt8 layer);
+
             static void Begin(const Camera2D& camera, const Mat4& transform);
             static void End();
             static void Flush();
+            static void Submit(const Renderer2DRecorder& recorder);
 
             static void DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color);
             static void DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, Float rotation);
@@ -42,6 +110,9 @@ namespace TE::Renderer
             static void DrawQuad(const Mat4& transform, const Ref<Texture2D>& texture, const Vec4& tint = Vec4(1.0f), Float tilingFactor = 1.0f);
             static void DrawQuad(const Mat4& transform, const Ref<SubTexture2D>& texture, const Vec4& tint = Vec4(1.0f), Float tilingFactor = 1.0f);
 
+            static void DrawQuads(std::span<const QuadDesc> quads);
+            static void DrawStaticBatch(StaticBatch& batch);
+
             struct Status 
             {
                 UInt32 DrawCount{TE_NULL};
@@ -51,4 +122,86 @@ namespace TE::Renderer
             static const Status& RenderingStatus();
             static void StatusReset();
     };
+
+    // Records quads on any thread for the Renderer2D mode it was created with; the recorded data is merged
+    // into the batch by Renderer2D::Submit on the render thread, which must be in the same mode. With
+    // sorting enabled the quads join the deferred queue and are ordered with everything else.
+    class Renderer2DRecorder
+    {
+        public:
+            explicit Renderer2DRecorder(Renderer2DMode mode) : m_Mode(mode) {}
+            ~Renderer2DRecorder() = default;
+
+            void Reset();
+            void Reset(Renderer2DMode mode);
+            void Reserve(UInt32 quadCount);
+
+            void DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, Float rotation = 0.0f);
+            void DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<Texture2D>& texture, Float rotation = 0.0f, Float tilingFactor = 1.0f);
+            void DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<SubTexture2D>& texture, Float rotation = 0.0f, Float tilingFactor = 1.0f);
+            void DrawQuad(const Mat4& transform, const Vec4& color);
+            void DrawQuad(const Mat4& transform, const Ref<Texture2D>& texture, const Vec4& tint = Vec4(1.0f), Float tilingFactor = 1.0f);
+            void DrawQuad(const Mat4& transform, const Ref<SubTexture2D>& texture, const Vec4& tint = Vec4(1.0f), Float tilingFactor = 1.0f);
+
+            Renderer2DMode GetMode() const { return m_Mode; }
+            UInt32 GetQuadCount() const { return static_cast<UInt32>(m_QuadTextures.size()); }
+
+        private:
+            UInt32 GetTextureIndex(const Ref<Texture2D>& texture);
+            void Emplace(const Vec3& position, const Vec2& size, Float rotation, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor);
+            void Emplace(const Mat4& transform, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor);
+            void Append(const Renderer2DRecorder& recorder);
+
+        private:
+            friend class Renderer2D;
+
+            Renderer2DMode m_Mode{ Renderer2DMode::Batch };
+            std::vector<QuadVertex> m_Vertices;
+            std::vector<QuadInstance> m_Instances;
+            std::vector<Ref<Texture2D>> m_Textures;
+            std::unordered_map<const Texture2D*, UInt32> m_TextureIndices;
+            std::vector<UInt32> m_QuadTextures;
+    };
+
+    // Quads recorded once into a GPU-resident vertex buffer; only ranges touched since the last draw are re-uploaded.
+    class StaticBatch
+    {
+        public:
+            StaticBatch(UInt32 maxQuads);
+            ~StaticBatch() = default;
+
+            UInt32 DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, Float rotation = 0.0f);
+            UInt32 DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<Texture2D>& texture, Float rotation = 0.0f, Float tilingFactor = 1.0f);
+            UInt32 DrawQuad(const Vec2& position, const Vec2& size, const Vec4& color, const Ref<SubTexture2D>& texture, Float rotation = 0.0f, Float tilingFactor = 1.0f);
+            UInt32 DrawQuad(const Mat4& transform, const Ref<Texture2D>& texture, const Vec4& tint = Vec4(1.0f), Float tilingFactor = 1.0f);
+
+            void SetQuad(UInt32 index, const Mat4& transform, const Vec4& color, const Ref<Texture2D>& texture, Float tilingFactor = 1.0f);
+            void SetQuad(UInt32 index, const Mat4& transform, const Vec4& color, const Ref<SubTexture2D>& texture, Float tilingFactor = 1.0f);
+
+            void Clear();
+            void Upload();
+
+            UInt32 GetQuadCount() const { return m_QuadCount; }
+            UInt32 GetMaxQuads() const { return m_MaxQuads; }
+            Boolean IsDirty() const { return m_DirtyBegin < m_DirtyEnd; }
+
+        private:
+            UInt32 GetTextureSlot(const Ref<Texture2D>& texture);
+            void Write(UInt32 index, const Mat4& transform, const Vec4& color, const Vec2* texCoords, const Ref<Texture2D>& texture, Float tilingFactor);
+            void ResolveTableIndices();
+
+        private:
+            friend class Renderer2D;
+
+            UInt32 m_MaxQuads{ TE_NULL };
+            UInt32 m_QuadCount{ TE_NULL };
+            UInt32 m_DirtyBegin{ TE_NULL };
+            UInt32 m_DirtyEnd{ TE_NULL };
+            std::vector<QuadVertex> m_Vertices;
+            std::vector<Ref<Texture2D>> m_Textures;                 // sampler slots, or the textures kept alive in table mode
+            std::vector<UInt32> m_TableIndices;                     // table index last baked for each texture in table mode
+            std::vector<UInt32> m_QuadTextures;                     // m_Textures slot of each quad
+            Ref<VertexArray> m_VAO{ nullptr };
+            Ref<VertexBuffer> m_VBO{ nullptr };
+    };
 }
\ No newline at end of file
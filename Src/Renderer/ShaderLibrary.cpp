@@ -0,0 +1,125 @@
+#include <algorithm>
+
+#include "ShaderLibrary.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Renderer
+{
+    Ref<Shader> ShaderLibrary::Load(const String& name, const Path& vtxShader, const Path& fragShader)
+    {
+        Ref<Shader> shader = CreateShader(name, vtxShader, fragShader);
+        Add(shader);
+        return shader;
+    }
+
+    void ShaderLibrary::Add(const Ref<Shader>& shader)
+    {
+        TRIMANA_ASSERT(!Exists(shader->GetName()), "Shader already exists in library");
+        m_Shaders[shader->GetName()] = shader;
+        if(m_Watcher && !shader->GetVertexPath().empty())
+            m_Watcher->Watch(shader->GetName(), shader->GetVertexPath(), shader->GetFragmentPath());
+
+        if(!shader->IsReady())
+            m_Pending.emplace_back(shader);
+    }
+
+    void ShaderLibrary::SetPlaceholder(const Ref<Shader>& shader)
+    {
+        m_Placeholder = shader;
+    }
+
+    void ShaderLibrary::SetPlaceholder(const String& name, const Ref<Shader>& shader)
+    {
+        m_Placeholders[name] = shader;
+    }
+
+    void ShaderLibrary::Clear()
+    {
+        m_Watcher = nullptr;
+        m_Shaders.clear();
+        m_Pending.clear();
+        m_Reloading.clear();
+        m_Placeholder = nullptr;
+        m_Placeholders.clear();
+    }
+
+    Boolean ShaderLibrary::Exists(const String& name) const
+    {
+        return m_Shaders.find(name) != m_Shaders.end();
+    }
+
+    Ref<Shader> ShaderLibrary::Get(const String& name) const
+    {
+        auto it = m_Shaders.find(name);
+        TRIMANA_ASSERT(it != m_Shaders.end(), "Shader not found in library");
+
+        const Ref<Shader>& shader = it->second;
+        if(shader->IsReady() && shader->IsValid())
+            return shader;
+
+        auto placeholder = m_Placeholders.find(name);
+        if(placeholder != m_Placeholders.end())
+            return placeholder->second;
+
+        return m_Placeholder ? m_Placeholder : shader;
+    }
+
+    void ShaderLibrary::EnableHotReload()
+    {
+        if(m_Watcher)
+            return;
+
+        m_Watcher = CreateScope<ShaderWatcher>();
+        for(auto& entry : m_Shaders)
+        {
+            const Ref<Shader>& shader = entry.second;
+            if(!shader->GetVertexPath().empty())
+                m_Watcher->Watch(shader->GetName(), shader->GetVertexPath(), shader->GetFragmentPath());
+        }
+
+        m_Watcher->Start();
+    }
+
+    // Call once per frame between submissions. Sources arrive already read by the watcher thread, so
+    // this only submits the new programs and swaps the ones the driver has finished linking.
+    void ShaderLibrary::Update()
+    {
+        Poll();
+        if(!m_Watcher)
+            return;
+
+        for(auto& update : m_Watcher->TakeUpdates())
+        {
+            auto it = m_Shaders.find(update.Name);
+            if(it == m_Shaders.end())
+                continue;
+
+            it->second->Reload(update.VertexSource, update.FragmentSource);
+            if(std::find(m_Reloading.begin(), m_Reloading.end(), it->second) == m_Reloading.end())
+                m_Reloading.emplace_back(it->second);
+        }
+
+        auto applied = std::remove_if(m_Reloading.begin(), m_Reloading.end(), [](const Ref<Shader>& shader) { return shader->ApplyReload(); });
+        m_Reloading.erase(applied, m_Reloading.end());
+    }
+
+    UInt32 ShaderLibrary::Poll()
+    {
+        auto ready = std::remove_if(m_Pending.begin(), m_Pending.end(), [](const Ref<Shader>& shader) { return shader->IsReady(); });
+        m_Pending.erase(ready, m_Pending.end());
+        return static_cast<UInt32>(m_Pending.size());
+    }
+
+    void ShaderLibrary::WaitAll()
+    {
+        for(auto& shader : m_Pending)
+            shader->IsValid();
+
+        m_Pending.clear();
+    }
+
+    UInt32 ShaderLibrary::GetPendingCount() const
+    {
+        return static_cast<UInt32>(m_Pending.size());
+    }
+}
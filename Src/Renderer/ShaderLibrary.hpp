@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+#include "TypeDef.hpp"
+#include "Shaders.hpp"
+#include "ShaderWatcher.hpp"
+
+namespace TE::Renderer
+{
+    // Submits every program up front so the driver can compile them in parallel; Get() hands out the
+    // placeholder until the requested program has finished linking. A placeholder registered for a
+    // name takes precedence over the shared one, for programs with their own vertex inputs.
+    class ShaderLibrary
+    {
+        public:
+            ShaderLibrary() = default;
+            ~ShaderLibrary() = default;
+
+            Ref<Shader> Load(const String& name, const Path& vtxShader, const Path& fragShader);
+            void Add(const Ref<Shader>& shader);
+            void SetPlaceholder(const Ref<Shader>& shader);
+            void SetPlaceholder(const String& name, const Ref<Shader>& shader);
+            void Clear();
+
+            Boolean Exists(const String& name) const;
+            Ref<Shader> Get(const String& name) const;
+
+            void EnableHotReload();
+            void Update();
+
+            UInt32 Poll();
+            void WaitAll();
+            UInt32 GetPendingCount() const;
+
+        private:
+            std::unordered_map<String, Ref<Shader>> m_Shaders;
+            std::vector<Ref<Shader>> m_Pending;
+            std::vector<Ref<Shader>> m_Reloading;
+            Scope<ShaderWatcher> m_Watcher{nullptr};
+            Ref<Shader> m_Placeholder{nullptr};
+            std::unordered_map<String, Ref<Shader>> m_Placeholders;
+    };
+}
@@ -0,0 +1,219 @@
+#include <chrono>
+#include <algorithm>
+
+#ifdef TRIMANA_PLATFORM_LINUX
+    #include <poll.h>
+    #include <unistd.h>
+    #include <sys/inotify.h>
+#endif
+
+#include "ShaderWatcher.hpp"
+#include "Asserts.hpp"
+#include "Instrument.hpp"
+
+namespace TE::Renderer
+{
+    static const Int32 WATCH_POLL_INTERVAL_MS = 100;
+
+    static String ReadSource(const Path& filePath)
+    {
+        String result{};
+        InputFile in_file(filePath, std::ios::in | std::ios::binary);
+        if(!in_file)
+            return result;
+
+        in_file.seekg(0, std::ios::end);
+        result.resize(in_file.tellg());
+        in_file.seekg(0, std::ios::beg);
+        in_file.read(&result[0], result.size());
+        return result;
+    }
+
+    static Path NormalizePath(const Path& filePath)
+    {
+        std::error_code error;
+        Path normalized = std::filesystem::weakly_canonical(filePath, error);
+        return error ? filePath.lexically_normal() : normalized;
+    }
+
+    ShaderWatcher::ShaderWatcher()
+    {
+        #ifdef TRIMANA_PLATFORM_LINUX
+            m_NotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if(m_NotifyFD < 0)
+                TE_CORE_WARN("inotify is unavailable, shader hot reload disabled");
+        #endif
+    }
+
+    ShaderWatcher::~ShaderWatcher()
+    {
+        Stop();
+
+        #ifdef TRIMANA_PLATFORM_LINUX
+            if(m_NotifyFD >= 0)
+                close(m_NotifyFD);
+        #endif
+    }
+
+    void ShaderWatcher::Watch(const String& name, const Path& vtxShader, const Path& fragShader)
+    {
+        WatchedShader shader{ name, NormalizePath(vtxShader), NormalizePath(fragShader) };
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        WatchDirectory(shader.VertexPath.parent_path());
+        WatchDirectory(shader.FragmentPath.parent_path());
+        m_Shaders.emplace_back(std::move(shader));
+    }
+
+    void ShaderWatcher::Start()
+    {
+        if(m_Running.exchange(TE_TRUE))
+            return;
+
+        m_Thread = std::thread(&ShaderWatcher::Run, this);
+    }
+
+    void ShaderWatcher::Stop()
+    {
+        if(!m_Running.exchange(TE_FALSE))
+            return;
+
+        if(m_Thread.joinable())
+            m_Thread.join();
+    }
+
+    std::vector<ShaderSourceUpdate> ShaderWatcher::TakeUpdates()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        std::vector<ShaderSourceUpdate> updates;
+        updates.swap(m_Updates);
+        return updates;
+    }
+
+    // Directories are watched rather than files because editors commonly save by renaming a temporary
+    // file over the original, which would silently drop a per-file watch.
+    void ShaderWatcher::WatchDirectory(const Path& directory)
+    {
+        #ifdef TRIMANA_PLATFORM_LINUX
+            if(m_NotifyFD < 0)
+                return;
+
+            for(auto& watched : m_Directories)
+            {
+                if(watched.second == directory)
+                    return;
+            }
+
+            Int32 descriptor = inotify_add_watch(m_NotifyFD, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+            if(descriptor < 0)
+            {
+                TE_CORE_WARN("Failed to watch shader directory '{0}'", directory.string());
+                return;
+            }
+
+            m_Directories[descriptor] = directory;
+        #endif
+    }
+
+    void ShaderWatcher::Run()
+    {
+        TE_PROFILE_THREAD("Shader Watcher");
+
+        #ifdef TRIMANA_PLATFORM_LINUX
+
+            alignas(inotify_event) char buffer[4096];
+            pollfd descriptor{ m_NotifyFD, POLLIN, 0 };
+            while(m_Running)
+            {
+                if(m_NotifyFD < 0 || poll(&descriptor, 1, WATCH_POLL_INTERVAL_MS) <= 0)
+                {
+                    if(m_NotifyFD < 0)
+                        std::this_thread::sleep_for(std::chrono::milliseconds(WATCH_POLL_INTERVAL_MS));
+
+                    continue;
+                }
+
+                ssize_t length = read(m_NotifyFD, buffer, sizeof(buffer));
+                for(ssize_t offset = 0; offset < length;)
+                {
+                    const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                    offset += sizeof(inotify_event) + event->len;
+                    if(event->len == 0)
+                        continue;
+
+                    Path changed{};
+                    {
+                        std::lock_guard<std::mutex> lock(m_Mutex);
+                        auto it = m_Directories.find(event->wd);
+                        if(it == m_Directories.end())
+                            continue;
+
+                        changed = it->second / event->name;
+                    }
+
+                    QueueReload(changed);
+                }
+            }
+
+        #else
+
+            std::unordered_map<String, std::filesystem::file_time_type> write_times;
+            while(m_Running)
+            {
+                std::vector<Path> files;
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    for(auto& shader : m_Shaders)
+                    {
+                        files.emplace_back(shader.VertexPath);
+                        files.emplace_back(shader.FragmentPath);
+                    }
+                }
+
+                for(auto& file : files)
+                {
+                    std::error_code error;
+                    auto write_time = std::filesystem::last_write_time(file, error);
+                    if(error)
+                        continue;
+
+                    auto it = write_times.find(file.string());
+                    if(it != write_times.end() && it->second != write_time)
+                        QueueReload(file);
+
+                    write_times[file.string()] = write_time;
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(WATCH_POLL_INTERVAL_MS));
+            }
+
+        #endif
+    }
+
+    void ShaderWatcher::QueueReload(const Path& changedFile)
+    {
+        std::vector<WatchedShader> affected;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for(auto& shader : m_Shaders)
+            {
+                if(shader.VertexPath == changedFile || shader.FragmentPath == changedFile)
+                    affected.emplace_back(shader);
+            }
+        }
+
+        for(auto& shader : affected)
+        {
+            ShaderSourceUpdate update{ shader.Name, ReadSource(shader.VertexPath), ReadSource(shader.FragmentPath) };
+            if(update.VertexSource.empty() || update.FragmentSource.empty())
+                continue;
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            auto it = std::find_if(m_Updates.begin(), m_Updates.end(), [&](const ShaderSourceUpdate& queued) { return queued.Name == update.Name; });
+            if(it != m_Updates.end())
+                *it = std::move(update);
+            else
+                m_Updates.emplace_back(std::move(update));
+        }
+    }
+}
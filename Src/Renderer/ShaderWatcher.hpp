@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+
+#include "TypeDef.hpp"
+
+namespace TE::Renderer
+{
+    struct ShaderSourceUpdate
+    {
+        String Name{};
+        String VertexSource{};
+        String FragmentSource{};
+    };
+
+    // Watches shader source files on a background thread and reads changed programs off the render
+    // thread. The owner drains the finished reads with TakeUpdates() at a frame boundary.
+    class ShaderWatcher
+    {
+        public:
+            ShaderWatcher();
+            ~ShaderWatcher();
+
+            void Watch(const String& name, const Path& vtxShader, const Path& fragShader);
+            void Start();
+            void Stop();
+
+            std::vector<ShaderSourceUpdate> TakeUpdates();
+
+        private:
+            struct WatchedShader
+            {
+                String Name{};
+                Path VertexPath{};
+                Path FragmentPath{};
+            };
+
+            void Run();
+            void WatchDirectory(const Path& directory);
+            void QueueReload(const Path& changedFile);
+
+        private:
+            std::mutex m_Mutex;
+            std::vector<WatchedShader> m_Shaders;
+            std::vector<ShaderSourceUpdate> m_Updates;
+            std::unordered_map<Int32, Path> m_Directories;
+            std::atomic<Boolean> m_Running{TE_FALSE};
+            std::thread m_Thread;
+            Int32 m_NotifyFD{-1};
+    };
+}
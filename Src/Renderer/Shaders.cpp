@@ -16,4 +16,31 @@ namespace TE::Renderer
         };
     }
 
+    Ref<Shader> CreateShaderFromSource(const String& name, std::string_view vtxSource, std::string_view fragSource)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:             TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:           return CreateRef<TE::APIs::OpenGL::GL_Shader>(name, vtxSource, fragSource);
+            case RendererAPI::Vulkan:           TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:          TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                            return nullptr;
+        };
+    }
+
+    // The stages are looked up by their asset names and go through the same path as in-memory source.
+    Ref<Shader> CreateShaderFromPack(const String& name, const TE::Core::AssetPack& pack, std::string_view vtxShader, std::string_view fragShader)
+    {
+        std::vector<UInt8> vtx_source;
+        std::vector<UInt8> frag_source;
+        if(!pack.Read(vtxShader, vtx_source) || !pack.Read(fragShader, frag_source))
+        {
+            TE_CORE_ERROR("Failed to read shader {0} from the asset pack", name);
+            return nullptr;
+        }
+
+        return CreateShaderFromSource(name,
+            std::string_view(reinterpret_cast<const char*>(vtx_source.data()), vtx_source.size()),
+            std::string_view(reinterpret_cast<const char*>(frag_source.data()), frag_source.size()));
+    }
 }
\ No newline at end of file
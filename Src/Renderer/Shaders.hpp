@@ -2,35 +2,71 @@
 
 #include <filesystem>
 #include <fstream>
+#include <string_view>
 #include <unordered_map>
 
 #include "TypeDef.hpp"
+#include "AssetPack.hpp"
 
 namespace TE::Renderer
 {
+    // 32-bit FNV-1a hash of a uniform name; literals are hashed at compile time.
+    class UniformID
+    {
+        public:
+            consteval UniformID(CString name) : m_Hash(Hash(std::string_view(name))) {}
+            explicit UniformID(std::string_view name) : m_Hash(Hash(name)) {}
+
+            static constexpr UInt32 Hash(std::string_view name)
+            {
+                UInt32 hash = 2166136261u;
+                for(char c : name)
+                {
+                    hash ^= static_cast<UInt8>(c);
+                    hash *= 16777619u;
+                }
+                return hash;
+            }
+
+            constexpr UInt32 GetHash() const { return m_Hash; }
+            constexpr bool operator==(const UniformID& other) const { return m_Hash == other.m_Hash; }
+            constexpr bool operator<(const UniformID& other) const { return m_Hash < other.m_Hash; }
+
+        private:
+            UInt32 m_Hash{ TE_NULL };
+    };
+
     class Shader
     {
         public:
             Shader() = default;
             virtual ~Shader() = default;
 
+            virtual Boolean IsReady() const = TE_NULL;
+            virtual Boolean IsValid() const = TE_NULL;
+            virtual void Reload(const String& vtxSource, const String& fragSource) = TE_NULL;
+            virtual Boolean ApplyReload() = TE_NULL;
+            virtual const Path& GetVertexPath() const = TE_NULL;
+            virtual const Path& GetFragmentPath() const = TE_NULL;
             virtual void Bind() const = TE_NULL;
             virtual void Unbind() const = TE_NULL;
             
             virtual ShaderProgramID GetID() const = TE_NULL;
             virtual const String& GetName() const = TE_NULL;
-            virtual UniformLocation GetUniformLocation(const String& uniformName) = TE_NULL;
-
-            virtual void SetUnifrom(const String& uniformName, Float value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, Int32 value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, UInt32 value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, const Vec2& value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, const Vec3& value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, const Vec4& value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, const Mat2& value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, const Mat3& value) = TE_NULL;
-            virtual void SetUniform(const String& uniformName, const Mat4& value) = TE_NULL;
+            virtual UniformLocation GetUniformLocation(UniformID uniform) const = TE_NULL;
+
+            virtual void SetUnifrom(UniformID uniform, Float value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, Int32 value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, UInt32 value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, const Vec2& value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, const Vec3& value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, const Vec4& value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, const Mat2& value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, const Mat3& value) = TE_NULL;
+            virtual void SetUniform(UniformID uniform, const Mat4& value) = TE_NULL;
     };
 
     Ref<Shader> CreateShader(const String& name, const Path& vtxShader, const Path& fragShader);
+    Ref<Shader> CreateShaderFromSource(const String& name, std::string_view vtxSource, std::string_view fragSource);
+    Ref<Shader> CreateShaderFromPack(const String& name, const TE::Core::AssetPack& pack, std::string_view vtxShader, std::string_view fragShader);
 }
\ No newline at end of file
@@ -29,6 +29,30 @@ namespace TE::Renderer
         };
     }
 
+    Ref<Texture2D> CreateTexture2D(const TextureImage& image)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:             TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:           return std::make_shared<TE::APIs::OpenGL::GL_Texture2D>(image);
+            case RendererAPI::Vulkan:           TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:          TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                            return nullptr;
+        };
+    }
+
+    Ref<Texture2D> CreatePendingTexture2D(const Ref<Texture2D>& placeholder)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:             TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:           return std::make_shared<TE::APIs::OpenGL::GL_Texture2D>(placeholder);
+            case RendererAPI::Vulkan:           TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:          TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                            return nullptr;
+        };
+    }
+
    Ref<SubTexture2D> CreateSubTexture2D(const Ref<Texture2D>& texture, const Vec2& coords, const Vec2 & cellSize, const Vec2& spriteSize)
     {
         switch(Renderer::GetAPI())
@@ -48,5 +72,15 @@ namespace TE::Renderer
         };
     }
 
-
+    Ref<SubTexture2D> CreateSubTexture2D(const Ref<Texture2D>& texture, const Vec2& min, const Vec2& max)
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:             TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:           return std::make_shared<TE::APIs::OpenGL::GL_SubTexture2D>(texture, min, max);
+            case RendererAPI::Vulkan:           TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:          TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                            return nullptr;
+        };
+    }
 }
\ No newline at end of file
@@ -1,9 +1,51 @@
 #pragma once
 
+#include <vector>
+
 #include "TypeDef.hpp"
 
 namespace TE::Renderer
 {
+    enum class TextureFormat
+    {
+        None    = 0,
+        RGB8    = 1,
+        RGBA8   = 2,
+        BC1     = 3,
+        BC3     = 4,
+        BC7     = 5
+    };
+
+    struct TextureMipLevel
+    {
+        UInt64 Offset{TE_NULL};
+        UInt64 Size{TE_NULL};
+        Int32 Width{TE_NULL};
+        Int32 Height{TE_NULL};
+    };
+
+    enum class TextureImageOwner
+    {
+        None    = 0,
+        Decoder = 1,
+        Heap    = 2,
+        Staging = 3
+    };
+
+    // Levels is empty for a single uncompressed image, which is uploaded without mips; otherwise it
+    // addresses a precomputed chain inside Pixels. A Staging image holds a byte offset into the
+    // staging buffer in Pixels rather than a pointer, and is uploaded with that buffer bound.
+    struct TextureImage
+    {
+        TextureData Pixels{nullptr};
+        Int32 Width{TE_NULL};
+        Int32 Height{TE_NULL};
+        Int32 Channels{TE_NULL};
+        TextureFormat Format{TextureFormat::None};
+        std::vector<TextureMipLevel> Levels{};
+        TextureImageOwner Owner{TextureImageOwner::None};
+    };
+
     class Texture2D
     {
         public:
@@ -18,7 +60,12 @@ namespace TE::Renderer
             virtual Int32 GetChannels() const = TE_NULL;
             virtual UInt32 GetInternalFormat() const = TE_NULL;
             virtual UInt32 GetDataFormat() const = TE_NULL;
-            virtual TextureData GetTextureData() const = TE_NULL;
+            virtual UInt32 GetMipLevels() const = TE_NULL;
+            virtual Boolean IsLoaded() const = TE_NULL;
+            virtual UInt64 GetSerial() const = TE_NULL;       // unique per texture, never reused
+            virtual UInt32 GetRevision() const = TE_NULL;     // advances whenever the contents change
+            virtual void Upload(const TextureImage& image) = TE_NULL;
+            virtual void UploadRegion(Int32 x, Int32 y, const TextureImage& image) = TE_NULL;
     };
 
     class SubTexture2D
@@ -35,6 +82,9 @@ namespace TE::Renderer
 
     Ref<Texture2D> CreateTexture2D(Int32 width, Int32 height);
     Ref<Texture2D> CreateTexture2D(const Path& path, Boolean flip = true);
+    Ref<Texture2D> CreateTexture2D(const TextureImage& image);
+    Ref<Texture2D> CreatePendingTexture2D(const Ref<Texture2D>& placeholder);
     Ref<SubTexture2D> CreateSubTexture2D(const Ref<Texture2D>& texture, const Vec2& coords, const Vec2& cellSize, const Vec2& spriteSize);
+    Ref<SubTexture2D> CreateSubTexture2D(const Ref<Texture2D>& texture, const Vec2& min, const Vec2& max);
 
 }
\ No newline at end of file
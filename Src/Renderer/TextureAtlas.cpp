@@ -0,0 +1,162 @@
+#include <limits>
+#include <algorithm>
+
+#include "TextureAtlas.hpp"
+#include "TextureFile.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Renderer
+{
+    TextureAtlas::TextureAtlas(UInt32 pageSize, UInt32 padding)
+    {
+        m_PageSize = static_cast<Int32>(pageSize);
+        m_Padding = static_cast<Int32>(padding);
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Add(const TextureImage& image)
+    {
+        TRIMANA_ASSERT(image.Pixels && image.Levels.empty(), "Only single uncompressed images can be packed into an atlas");
+
+        Int32 padded_width = image.Width + m_Padding * 2;
+        Int32 padded_height = image.Height + m_Padding * 2;
+        if(padded_width > m_PageSize || padded_height > m_PageSize)
+        {
+            TE_CORE_ERROR("Image of {0}x{1} does not fit in a {2}x{2} atlas page", image.Width, image.Height, m_PageSize);
+            return nullptr;
+        }
+
+        Int32 x = 0;
+        Int32 y = 0;
+        AtlasPage* page = nullptr;
+        for(auto& candidate : m_Pages)
+        {
+            if(Pack(candidate, padded_width, padded_height, x, y))
+            {
+                page = &candidate;
+                break;
+            }
+        }
+
+        if(!page)
+        {
+            page = &CreatePage();
+            Pack(*page, padded_width, padded_height, x, y);
+        }
+
+        std::vector<UInt8> pixels(static_cast<size_t>(padded_width) * padded_height * 4);
+        for(Int32 row = 0; row < padded_height; row++)
+        {
+            Int32 source_row = std::clamp(row - m_Padding, 0, image.Height - 1);
+            for(Int32 column = 0; column < padded_width; column++)
+            {
+                Int32 source_column = std::clamp(column - m_Padding, 0, image.Width - 1);
+                const UInt8* source = image.Pixels + (static_cast<size_t>(source_row) * image.Width + source_column) * image.Channels;
+                UInt8* destination = pixels.data() + (static_cast<size_t>(row) * padded_width + column) * 4;
+                destination[0] = source[0];
+                destination[1] = source[1];
+                destination[2] = source[2];
+                destination[3] = (image.Channels == 4) ? source[3] : 255;
+            }
+        }
+
+        page->Texture->UploadRegion(x, y, { pixels.data(), padded_width, padded_height, 4, TextureFormat::RGBA8 });
+
+        Float size = static_cast<Float>(m_PageSize);
+        Vec2 min = { (x + m_Padding) / size, (y + m_Padding) / size };
+        Vec2 max = { (x + m_Padding + image.Width) / size, (y + m_Padding + image.Height) / size };
+        return CreateSubTexture2D(page->Texture, min, max);
+    }
+
+    Ref<SubTexture2D> TextureAtlas::Add(const Path& path, Boolean flip)
+    {
+        TextureImage image{};
+        if(!ReadTextureFile(path, flip, image) || !image.Levels.empty())
+        {
+            TE_CORE_ERROR("Failed to load atlas image -> {0}!", path.string());
+            ReleaseTextureImage(image);
+            return nullptr;
+        }
+
+        Ref<SubTexture2D> region = Add(image);
+        ReleaseTextureImage(image);
+        return region;
+    }
+
+    AtlasPage& TextureAtlas::CreatePage()
+    {
+        AtlasPage page{};
+        page.Texture = CreateTexture2D(m_PageSize, m_PageSize);
+        page.Skyline.push_back({ 0, 0, m_PageSize });
+        m_Pages.emplace_back(std::move(page));
+        return m_Pages.back();
+    }
+
+    // Bottom-left skyline: place the rectangle where its top edge ends lowest, preferring the narrowest
+    // segment on ties, then raise the skyline over its span.
+    Boolean TextureAtlas::Pack(AtlasPage& page, Int32 width, Int32 height, Int32& x, Int32& y)
+    {
+        std::vector<AtlasSkylineNode>& skyline = page.Skyline;
+        Int32 best_index = -1;
+        Int32 best_top = std::numeric_limits<Int32>::max();
+        Int32 best_width = std::numeric_limits<Int32>::max();
+
+        for(Int32 i = 0; i < static_cast<Int32>(skyline.size()); i++)
+        {
+            if(skyline[i].X + width > m_PageSize)
+                break;
+
+            Int32 top = 0;
+            Int32 remaining = width;
+            for(Int32 j = i; remaining > 0; j++)
+            {
+                top = std::max(top, skyline[j].Y);
+                remaining -= skyline[j].Width;
+            }
+
+            if(top + height > m_PageSize)
+                continue;
+
+            if(top + height < best_top || (top + height == best_top && skyline[i].Width < best_width))
+            {
+                best_index = i;
+                best_top = top + height;
+                best_width = skyline[i].Width;
+                x = skyline[i].X;
+                y = top;
+            }
+        }
+
+        if(best_index < 0)
+            return TE_FALSE;
+
+        skyline.insert(skyline.begin() + best_index, { x, y + height, width });
+        for(size_t i = best_index + 1; i < skyline.size();)
+        {
+            Int32 overlap = skyline[i - 1].X + skyline[i - 1].Width - skyline[i].X;
+            if(overlap <= 0)
+                break;
+
+            if(overlap < skyline[i].Width)
+            {
+                skyline[i].X += overlap;
+                skyline[i].Width -= overlap;
+                break;
+            }
+
+            skyline.erase(skyline.begin() + i);
+        }
+
+        for(size_t i = 0; i + 1 < skyline.size();)
+        {
+            if(skyline[i].Y == skyline[i + 1].Y)
+            {
+                skyline[i].Width += skyline[i + 1].Width;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+            else
+                i++;
+        }
+
+        return TE_TRUE;
+    }
+}
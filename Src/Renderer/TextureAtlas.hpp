@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+
+#include "TypeDef.hpp"
+#include "Texture2D.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt32 DEFAULT_ATLAS_PAGE_SIZE     = 2048;
+    static const UInt32 DEFAULT_ATLAS_PADDING       = 2;
+
+    struct AtlasSkylineNode
+    {
+        Int32 X{TE_NULL};
+        Int32 Y{TE_NULL};
+        Int32 Width{TE_NULL};
+    };
+
+    struct AtlasPage
+    {
+        Ref<Texture2D> Texture{nullptr};
+        std::vector<AtlasSkylineNode> Skyline{};
+    };
+
+    // Packs images into shared pages with a bottom-left skyline so Renderer2D can draw them from a few
+    // texture slots. Each image is surrounded by `padding` texels extruded from its own edges so linear
+    // filtering never samples a neighbour. Pages have no mips: a 2-texel border stops covering the
+    // footprint from mip 2 onward, so minified sampling would bleed neighbouring images.
+    class TextureAtlas
+    {
+        public:
+            TextureAtlas(UInt32 pageSize = DEFAULT_ATLAS_PAGE_SIZE, UInt32 padding = DEFAULT_ATLAS_PADDING);
+            ~TextureAtlas() = default;
+
+            Ref<SubTexture2D> Add(const TextureImage& image);
+            Ref<SubTexture2D> Add(const Path& path, Boolean flip = true);
+
+            UInt32 GetPageCount() const { return static_cast<UInt32>(m_Pages.size()); }
+            const Ref<Texture2D>& GetPage(UInt32 index) const { return m_Pages[index].Texture; }
+
+        private:
+            AtlasPage& CreatePage();
+            Boolean Pack(AtlasPage& page, Int32 width, Int32 height, Int32& x, Int32& y);
+
+        private:
+            Int32 m_PageSize{TE_NULL};
+            Int32 m_Padding{TE_NULL};
+            std::vector<AtlasPage> m_Pages;
+    };
+}
@@ -0,0 +1,254 @@
+#include <memory>
+#include <span>
+#include <string_view>
+#include <cstring>
+#include <algorithm>
+
+#include <stb/stb_image.h>
+
+#include "TextureFile.hpp"
+#include "Asserts.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt8 KTX2_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    struct KTX2Header
+    {
+        UInt8 Identifier[12]{};
+        UInt32 VkFormat{ TE_NULL };
+        UInt32 TypeSize{ TE_NULL };
+        UInt32 PixelWidth{ TE_NULL };
+        UInt32 PixelHeight{ TE_NULL };
+        UInt32 PixelDepth{ TE_NULL };
+        UInt32 LayerCount{ TE_NULL };
+        UInt32 FaceCount{ TE_NULL };
+        UInt32 LevelCount{ TE_NULL };
+        UInt32 SupercompressionScheme{ TE_NULL };
+        UInt32 DfdByteOffset{ TE_NULL };
+        UInt32 DfdByteLength{ TE_NULL };
+        UInt32 KvdByteOffset{ TE_NULL };
+        UInt32 KvdByteLength{ TE_NULL };
+        UInt64 SgdByteOffset{ TE_NULL };
+        UInt64 SgdByteLength{ TE_NULL };
+    };
+
+    struct KTX2LevelIndex
+    {
+        UInt64 ByteOffset{ TE_NULL };
+        UInt64 ByteLength{ TE_NULL };
+        UInt64 UncompressedByteLength{ TE_NULL };
+    };
+
+    static TextureFormat FromVkFormat(UInt32 format)
+    {
+        switch(format)
+        {
+            case 37:  case 43:              return TextureFormat::RGBA8;    // VK_FORMAT_R8G8B8A8_UNORM / _SRGB
+            case 131: case 132:
+            case 133: case 134:             return TextureFormat::BC1;      // VK_FORMAT_BC1_RGB(A)_UNORM/SRGB_BLOCK
+            case 137: case 138:             return TextureFormat::BC3;      // VK_FORMAT_BC3_UNORM/SRGB_BLOCK
+            case 145: case 146:             return TextureFormat::BC7;      // VK_FORMAT_BC7_UNORM/SRGB_BLOCK
+            default:                        return TextureFormat::None;
+        }
+    }
+
+    static TextureFormat FromDXGIFormat(UInt32 format)
+    {
+        switch(format)
+        {
+            case 28: case 29:               return TextureFormat::RGBA8;    // DXGI_FORMAT_R8G8B8A8_UNORM / _SRGB
+            case 71: case 72:               return TextureFormat::BC1;
+            case 77: case 78:               return TextureFormat::BC3;
+            case 98: case 99:               return TextureFormat::BC7;
+            default:                        return TextureFormat::None;
+        }
+    }
+
+    // Containers are parsed in place: the levels address the caller's bytes and nothing is copied.
+    static Boolean BorrowLevels(std::string_view name, std::span<const UInt8> bytes, TextureImage& image)
+    {
+        for(auto& level : image.Levels)
+        {
+            if(level.Offset + level.Size > bytes.size())
+            {
+                TE_CORE_ERROR("Texture container {0} is truncated", name);
+                image.Levels.clear();
+                return TE_FALSE;
+            }
+        }
+
+        image.Pixels = const_cast<UInt8*>(bytes.data());
+        image.Channels = 4;
+        image.Owner = TextureImageOwner::None;
+        return TE_TRUE;
+    }
+
+    static Boolean ReadDDS(std::string_view name, std::span<const UInt8> bytes, TextureImage& image)
+    {
+        UInt64 offset = sizeof(UInt32) + sizeof(DDSHeader);
+        if(bytes.size() < offset)
+            return TE_FALSE;
+
+        DDSHeader header{};
+        std::memcpy(&header, bytes.data() + sizeof(UInt32), sizeof(DDSHeader));
+
+        if(header.PixelFormat.FourCC == DDS_FOURCC_DXT1)
+            image.Format = TextureFormat::BC1;
+        else if(header.PixelFormat.FourCC == DDS_FOURCC_DXT5)
+            image.Format = TextureFormat::BC3;
+        else if(header.PixelFormat.FourCC == DDS_FOURCC_DX10 && bytes.size() >= offset + sizeof(DDSHeaderDX10))
+        {
+            DDSHeaderDX10 dx10{};
+            std::memcpy(&dx10, bytes.data() + offset, sizeof(DDSHeaderDX10));
+            image.Format = FromDXGIFormat(dx10.DXGIFormat);
+            offset += sizeof(DDSHeaderDX10);
+        }
+
+        if(image.Format == TextureFormat::None)
+        {
+            TE_CORE_ERROR("Unsupported DDS pixel format in {0}", name);
+            return TE_FALSE;
+        }
+
+        image.Width = static_cast<Int32>(header.Width);
+        image.Height = static_cast<Int32>(header.Height);
+
+        UInt32 level_count = std::max(1u, (header.Flags & DDS_FLAGS_MIPMAPCOUNT) ? header.MipMapCount : 1u);
+        Int32 width = image.Width;
+        Int32 height = image.Height;
+        for(UInt32 level = 0; level < level_count; level++)
+        {
+            UInt64 size = TextureLevelSize(image.Format, width, height);
+            image.Levels.push_back({ offset, size, width, height });
+            offset += size;
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+
+        return BorrowLevels(name, bytes, image);
+    }
+
+    static Boolean ReadKTX2(std::string_view name, std::span<const UInt8> bytes, TextureImage& image)
+    {
+        if(bytes.size() < sizeof(KTX2Header))
+            return TE_FALSE;
+
+        KTX2Header header{};
+        std::memcpy(&header, bytes.data(), sizeof(KTX2Header));
+        image.Format = FromVkFormat(header.VkFormat);
+
+        if(image.Format == TextureFormat::None || header.SupercompressionScheme != 0 || header.LayerCount > 1 || header.FaceCount > 1 || header.PixelDepth > 1)
+        {
+            TE_CORE_ERROR("Unsupported KTX2 layout in {0}: only single 2D images without supercompression are loaded", name);
+            return TE_FALSE;
+        }
+
+        image.Width = static_cast<Int32>(header.PixelWidth);
+        image.Height = static_cast<Int32>(header.PixelHeight);
+
+        UInt32 level_count = std::max(1u, header.LevelCount);
+        if(bytes.size() < sizeof(KTX2Header) + level_count * sizeof(KTX2LevelIndex))
+            return TE_FALSE;
+
+        for(UInt32 level = 0; level < level_count; level++)
+        {
+            KTX2LevelIndex index{};
+            std::memcpy(&index, bytes.data() + sizeof(KTX2Header) + level * sizeof(KTX2LevelIndex), sizeof(KTX2LevelIndex));
+            image.Levels.push_back({ index.ByteOffset, index.ByteLength, std::max(1, image.Width >> level), std::max(1, image.Height >> level) });
+        }
+
+        return BorrowLevels(name, bytes, image);
+    }
+
+    static Boolean IsContainer(std::span<const UInt8> bytes)
+    {
+        return (bytes.size() >= sizeof(UInt32) && *reinterpret_cast<const UInt32*>(bytes.data()) == DDS_MAGIC) ||
+               (bytes.size() >= sizeof(KTX2_IDENTIFIER) && std::memcmp(bytes.data(), KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0);
+    }
+
+    static Boolean ReadContainer(std::string_view name, std::span<const UInt8> bytes, TextureImage& image)
+    {
+        if(bytes.size() >= sizeof(UInt32) && *reinterpret_cast<const UInt32*>(bytes.data()) == DDS_MAGIC)
+            return ReadDDS(name, bytes, image);
+
+        return ReadKTX2(name, bytes, image);
+    }
+
+    Boolean ReadTextureFile(const Path& path, Boolean flip, TextureImage& image)
+    {
+        image = TextureImage{};
+        Path extension = path.extension();
+        if(extension == ".dds" || extension == ".ktx2")
+        {
+            InputFile in_file(path, std::ios::in | std::ios::binary);
+            if(!in_file)
+                return TE_FALSE;
+
+            in_file.seekg(0, std::ios::end);
+            UInt64 size = static_cast<UInt64>(in_file.tellg());
+            Scope<UInt8[]> bytes = std::make_unique<UInt8[]>(size);
+            in_file.seekg(0, std::ios::beg);
+            if(!in_file.read(reinterpret_cast<char*>(bytes.get()), size))
+                return TE_FALSE;
+
+            std::span<const UInt8> view(bytes.get(), size);
+            if(!IsContainer(view))
+            {
+                TE_CORE_ERROR("Unrecognised texture container {0}", path.string());
+                return TE_FALSE;
+            }
+
+            if(!ReadContainer(path.string(), view, image))
+                return TE_FALSE;
+
+            image.Pixels = bytes.release();
+            image.Owner = TextureImageOwner::Heap;
+            return TE_TRUE;
+        }
+
+        Int32 channels = TE_NULL;
+        if(!stbi_info(path.string().c_str(), &image.Width, &image.Height, &channels))
+            return TE_FALSE;
+
+        image.Channels = (channels == 3) ? 3 : 4;
+        image.Format = (image.Channels == 4) ? TextureFormat::RGBA8 : TextureFormat::RGB8;
+        stbi_set_flip_vertically_on_load_thread(flip);
+        image.Pixels = stbi_load(path.string().c_str(), &image.Width, &image.Height, &channels, image.Channels);
+        image.Owner = TextureImageOwner::Decoder;
+        return image.Pixels != nullptr;
+    }
+
+    Boolean ReadTextureMemory(std::span<const UInt8> bytes, Boolean flip, TextureImage& image, std::string_view name)
+    {
+        image = TextureImage{};
+        if(IsContainer(bytes))
+            return ReadContainer(name, bytes, image);
+
+        Int32 channels = TE_NULL;
+        Int32 length = static_cast<Int32>(bytes.size());
+        if(!stbi_info_from_memory(bytes.data(), length, &image.Width, &image.Height, &channels))
+            return TE_FALSE;
+
+        image.Channels = (channels == 3) ? 3 : 4;
+        image.Format = (image.Channels == 4) ? TextureFormat::RGBA8 : TextureFormat::RGB8;
+        stbi_set_flip_vertically_on_load_thread(flip);
+        image.Pixels = stbi_load_from_memory(bytes.data(), length, &image.Width, &image.Height, &channels, image.Channels);
+        image.Owner = TextureImageOwner::Decoder;
+        return image.Pixels != nullptr;
+    }
+
+    void ReleaseTextureImage(TextureImage& image)
+    {
+        switch(image.Owner)
+        {
+            case TextureImageOwner::Decoder:    stbi_image_free(image.Pixels); break;
+            case TextureImageOwner::Heap:       delete[] image.Pixels; break;
+            default:                            break;
+        }
+
+        image.Pixels = nullptr;
+        image.Owner = TextureImageOwner::None;
+        image.Levels.clear();
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <span>
+#include <algorithm>
+#include <string_view>
+
+#include "TypeDef.hpp"
+#include "Texture2D.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt32 DDS_MAGIC                   = 0x20534444;
+    static const UInt32 DDS_FOURCC_DXT1             = 0x31545844;
+    static const UInt32 DDS_FOURCC_DXT5             = 0x35545844;
+    static const UInt32 DDS_FOURCC_DX10             = 0x30315844;
+    static const UInt32 DDS_FLAGS_CAPS              = 0x1;
+    static const UInt32 DDS_FLAGS_HEIGHT            = 0x2;
+    static const UInt32 DDS_FLAGS_WIDTH             = 0x4;
+    static const UInt32 DDS_FLAGS_PIXELFORMAT       = 0x1000;
+    static const UInt32 DDS_FLAGS_MIPMAPCOUNT       = 0x20000;
+    static const UInt32 DDS_FLAGS_LINEARSIZE        = 0x80000;
+    static const UInt32 DDS_PIXELFORMAT_FOURCC      = 0x4;
+    static const UInt32 DDS_CAPS_COMPLEX            = 0x8;
+    static const UInt32 DDS_CAPS_TEXTURE            = 0x1000;
+    static const UInt32 DDS_CAPS_MIPMAP             = 0x400000;
+
+    struct DDSPixelFormat
+    {
+        UInt32 Size{ 32 };
+        UInt32 Flags{ TE_NULL };
+        UInt32 FourCC{ TE_NULL };
+        UInt32 RGBBitCount{ TE_NULL };
+        UInt32 BitMasks[4]{};
+    };
+
+    struct DDSHeader
+    {
+        UInt32 Size{ 124 };
+        UInt32 Flags{ TE_NULL };
+        UInt32 Height{ TE_NULL };
+        UInt32 Width{ TE_NULL };
+        UInt32 PitchOrLinearSize{ TE_NULL };
+        UInt32 Depth{ TE_NULL };
+        UInt32 MipMapCount{ TE_NULL };
+        UInt32 Reserved1[11]{};
+        DDSPixelFormat PixelFormat{};
+        UInt32 Caps[4]{};
+        UInt32 Reserved2{ TE_NULL };
+    };
+
+    struct DDSHeaderDX10
+    {
+        UInt32 DXGIFormat{ TE_NULL };
+        UInt32 ResourceDimension{ TE_NULL };
+        UInt32 MiscFlag{ TE_NULL };
+        UInt32 ArraySize{ TE_NULL };
+        UInt32 MiscFlags2{ TE_NULL };
+    };
+
+    static_assert(sizeof(DDSHeader) == 124, "DDSHeader must match the on-disk layout");
+
+    inline UInt32 TextureFormatBlockBytes(TextureFormat format)
+    {
+        switch(format)
+        {
+            case TextureFormat::BC1:        return 8;
+            case TextureFormat::BC3:        return 16;
+            case TextureFormat::BC7:        return 16;
+            default:                        return TE_NULL;
+        }
+    }
+
+    inline UInt64 TextureLevelSize(TextureFormat format, Int32 width, Int32 height)
+    {
+        switch(format)
+        {
+            case TextureFormat::RGB8:       return static_cast<UInt64>(width) * height * 3;
+            case TextureFormat::RGBA8:      return static_cast<UInt64>(width) * height * 4;
+            default:                        return static_cast<UInt64>(std::max(1, (width + 3) / 4)) * std::max(1, (height + 3) / 4) * TextureFormatBlockBytes(format);
+        }
+    }
+
+    // Byte range of the pixel data an image references. Container levels are not stored in level order
+    // (KTX2 keeps the smallest mip first), so the range spans the lowest offset to the highest end.
+    inline UInt64 TextureImageSpan(const TextureImage& image, UInt64& first)
+    {
+        if(image.Levels.empty())
+        {
+            first = TE_NULL;
+            return static_cast<UInt64>(image.Width) * image.Height * image.Channels;
+        }
+
+        first = image.Levels.front().Offset;
+        UInt64 end = TE_NULL;
+        for(const TextureMipLevel& level : image.Levels)
+        {
+            first = std::min(first, level.Offset);
+            end = std::max(end, level.Offset + level.Size);
+        }
+
+        return end - first;
+    }
+
+    // Decodes PNG/JPG/... through stb_image, or maps DDS and KTX2 containers with precomputed mip chains.
+    // Block-compressed payloads cannot be flipped at load time; the offline converter flips them instead.
+    // Containers read from memory keep pointing into `bytes`, which must outlive the image.
+    Boolean ReadTextureFile(const Path& path, Boolean flip, TextureImage& image);
+    Boolean ReadTextureMemory(std::span<const UInt8> bytes, Boolean flip, TextureImage& image, std::string_view name = "<memory>");
+    void ReleaseTextureImage(TextureImage& image);
+}
@@ -0,0 +1,194 @@
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "TextureLoader.hpp"
+#include "TextureFile.hpp"
+#include "Buffers.hpp"
+#include "ThreadPool.hpp"
+#include "Asserts.hpp"
+#include "Instrument.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt64 TEXTURE_STAGING_SIZE = 4 * DEFAULT_TEXTURE_UPLOAD_BUDGET;
+
+    struct DecodedTexture
+    {
+        Ref<Texture2D> Texture{ nullptr };
+        TextureImage Image{};
+        Path FilePath{};
+    };
+
+    struct TextureLoaderData
+    {
+        Scope<TE::Core::ThreadPool> Workers{ nullptr };
+        Ref<StagingBuffer> Staging{ nullptr };
+        Ref<Texture2D> Placeholder{ nullptr };
+        std::mutex Mutex;
+        std::deque<DecodedTexture> Decoded;
+        std::atomic<UInt32> Pending{ TE_NULL };
+
+    }; static TextureLoaderData s_LoaderData;
+
+    // Runs on a worker: the decoded pixels are copied into the mapped staging ring so the render thread
+    // only issues the GPU-side copy. When the ring is full the image stays in client memory instead.
+    static void StageImage(TextureImage& image)
+    {
+        if(!s_LoaderData.Staging || !image.Pixels)
+            return;
+
+        UInt64 first = TE_NULL;
+        UInt64 offset = TE_NULL;
+        UInt64 size = TextureImageSpan(image, first);
+        void* staged = s_LoaderData.Staging->Allocate(size, offset);
+        if(!staged)
+            return;
+
+        std::memcpy(staged, image.Pixels + first, size);
+
+        std::vector<TextureMipLevel> levels = std::move(image.Levels);
+        for(auto& level : levels)
+            level.Offset -= first;
+
+        ReleaseTextureImage(image);
+        image.Pixels = reinterpret_cast<TextureData>(static_cast<std::uintptr_t>(offset));
+        image.Levels = std::move(levels);
+        image.Owner = TextureImageOwner::Staging;
+    }
+
+    void TextureLoader::Init(UInt32 workerCount)
+    {
+        s_LoaderData.Staging = CreateStagingBuffer(TEXTURE_STAGING_SIZE);
+        s_LoaderData.Workers = CreateScope<TE::Core::ThreadPool>(workerCount, "Texture Loader");
+        s_LoaderData.Placeholder = CreateTexture2D(1, 1);
+        s_LoaderData.Pending = TE_NULL;
+    }
+
+    void TextureLoader::Shutdown()
+    {
+        s_LoaderData.Workers = nullptr;
+        for(auto& decoded : s_LoaderData.Decoded)
+            ReleaseTextureImage(decoded.Image);
+
+        s_LoaderData.Decoded.clear();
+        s_LoaderData.Staging = nullptr;
+        s_LoaderData.Placeholder = nullptr;
+        s_LoaderData.Pending = TE_NULL;
+    }
+
+    Ref<Texture2D> TextureLoader::Load(const Path& path, Boolean flip)
+    {
+        TRIMANA_ASSERT(s_LoaderData.Workers, "TextureLoader::Init was not called");
+
+        Ref<Texture2D> texture = CreatePendingTexture2D(s_LoaderData.Placeholder);
+        s_LoaderData.Pending++;
+        s_LoaderData.Workers->Submit([texture, path, flip]()
+        {
+            DecodedTexture decoded{ texture, {}, path };
+            if(!ReadTextureFile(path, flip, decoded.Image))
+                ReleaseTextureImage(decoded.Image);
+
+            StageImage(decoded.Image);
+
+            std::lock_guard<std::mutex> lock(s_LoaderData.Mutex);
+            s_LoaderData.Decoded.emplace_back(std::move(decoded));
+        });
+
+        return texture;
+    }
+
+    Ref<Texture2D> TextureLoader::Load(std::span<const UInt8> bytes, const Path& name, Boolean flip)
+    {
+        TRIMANA_ASSERT(s_LoaderData.Workers, "TextureLoader::Init was not called");
+
+        Ref<Texture2D> texture = CreatePendingTexture2D(s_LoaderData.Placeholder);
+        s_LoaderData.Pending++;
+        s_LoaderData.Workers->Submit([texture, bytes, name, flip]()
+        {
+            DecodedTexture decoded{ texture, {}, name };
+            if(!ReadTextureMemory(bytes, flip, decoded.Image, name.string()))
+                ReleaseTextureImage(decoded.Image);
+
+            StageImage(decoded.Image);
+
+            std::lock_guard<std::mutex> lock(s_LoaderData.Mutex);
+            s_LoaderData.Decoded.emplace_back(std::move(decoded));
+        });
+
+        return texture;
+    }
+
+    void TextureLoader::SetPlaceholder(const Ref<Texture2D>& placeholder)
+    {
+        s_LoaderData.Placeholder = placeholder;
+    }
+
+    const Ref<Texture2D>& TextureLoader::GetPlaceholder()
+    {
+        return s_LoaderData.Placeholder;
+    }
+
+    // Uploads decoded images until the byte budget is spent; at least one image goes up per call so a
+    // texture larger than the budget cannot stall the queue.
+    void TextureLoader::Update(UInt64 uploadBudget)
+    {
+        UInt64 uploaded = TE_NULL;
+        while(uploaded < uploadBudget)
+        {
+            DecodedTexture decoded;
+            {
+                std::lock_guard<std::mutex> lock(s_LoaderData.Mutex);
+                if(s_LoaderData.Decoded.empty())
+                    break;
+
+                decoded = std::move(s_LoaderData.Decoded.front());
+                s_LoaderData.Decoded.pop_front();
+            }
+
+            s_LoaderData.Pending--;
+            const Boolean staged = (decoded.Image.Owner == TextureImageOwner::Staging);
+            if(!decoded.Image.Pixels && !staged)
+            {
+                TE_CORE_ERROR("Failed to load texture file -> {0}!", decoded.FilePath.string());
+                continue;
+            }
+
+            if(staged)
+                s_LoaderData.Staging->Bind();
+
+            UInt64 first = TE_NULL;
+            decoded.Texture->Upload(decoded.Image);
+            uploaded += TextureImageSpan(decoded.Image, first);
+
+            if(staged)
+            {
+                s_LoaderData.Staging->Unbind();
+                s_LoaderData.Staging->Consume(reinterpret_cast<std::uintptr_t>(decoded.Image.Pixels));
+            }
+
+            ReleaseTextureImage(decoded.Image);
+        }
+
+        if(s_LoaderData.Staging)
+            s_LoaderData.Staging->Fence();
+
+        TE_PROFILE_COUNTER("Texture Uploads (bytes)", uploaded);
+        TE_PROFILE_COUNTER("Pending Textures", s_LoaderData.Pending.load());
+    }
+
+    void TextureLoader::Flush()
+    {
+        if(s_LoaderData.Workers)
+            s_LoaderData.Workers->Wait();
+
+        Update(UINT64_MAX);
+    }
+
+    UInt32 TextureLoader::GetPendingCount()
+    {
+        return s_LoaderData.Pending;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <span>
+
+#include "TypeDef.hpp"
+#include "Texture2D.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt64 DEFAULT_TEXTURE_UPLOAD_BUDGET = 16 * 1024 * 1024;
+
+    // Decodes image files on a worker pool and uploads them in per-frame budgets. Workers copy the
+    // pixels into a mapped staging ring, so Update() only issues GPU-side copies. Load() returns a
+    // texture that renders as the placeholder until Update() has uploaded its pixels. The window calls
+    // Update() once per frame after the swap.
+    class TextureLoader
+    {
+        private:
+            TextureLoader() = default;
+            ~TextureLoader() = default;
+
+        public:
+            static void Init(UInt32 workerCount = TE_NULL);
+            static void Shutdown();
+
+            static Ref<Texture2D> Load(const Path& path, Boolean flip = true);
+            // `bytes` must stay valid until the texture has been uploaded, e.g. a span into a mapped AssetPack.
+            static Ref<Texture2D> Load(std::span<const UInt8> bytes, const Path& name, Boolean flip = true);
+            static void SetPlaceholder(const Ref<Texture2D>& placeholder);
+            static const Ref<Texture2D>& GetPlaceholder();
+
+            static void Update(UInt64 uploadBudget = DEFAULT_TEXTURE_UPLOAD_BUDGET);
+            static void Flush();
+            static UInt32 GetPendingCount();
+    };
+}
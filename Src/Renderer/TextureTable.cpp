@@ -0,0 +1,28 @@
+#include "TextureTable.hpp"
+#include "Renderer.hpp"
+
+#include "OpenGL/OpenGL.hpp"
+
+namespace TE::Renderer
+{
+    Ref<TextureTable> CreateTextureTable()
+    {
+        switch(Renderer::GetAPI())
+        {
+            case RendererAPI::None:             TRIMANA_ASSERT(TE_FALSE, "No rendering API selected"); return nullptr;
+            case RendererAPI::OpenGL:
+            {
+                if(TE::APIs::OpenGL::GL_BindlessTextureTable::IsSupported())
+                    return CreateRef<TE::APIs::OpenGL::GL_BindlessTextureTable>();
+
+                if(TE::APIs::OpenGL::GL_ArrayTextureTable::IsSupported())
+                    return CreateRef<TE::APIs::OpenGL::GL_ArrayTextureTable>();
+
+                return nullptr;
+            }
+            case RendererAPI::Vulkan:           TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            case RendererAPI::DirectX:          TRIMANA_ASSERT(TE_FALSE, "Not implemented yet"); return nullptr;
+            default:                            return nullptr;
+        };
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "TypeDef.hpp"
+#include "Texture2D.hpp"
+
+namespace TE::Renderer
+{
+    static const UInt32 INVALID_TEXTURE_INDEX = 0xFFFFFFFF;
+
+    enum class TextureTableType
+    {
+        Bindless        = 0,
+        TextureArray    = 1
+    };
+
+    class TextureTable
+    {
+        public:
+            TextureTable() = default;
+            virtual ~TextureTable() = default;
+
+            virtual void Bind() const = TE_NULL;
+            virtual void Clear() = TE_NULL;
+            virtual UInt32 GetIndex(const Ref<Texture2D>& texture) = TE_NULL;     // INVALID_TEXTURE_INDEX when the table is full or the texture has no storage
+            virtual UInt32 GetCount() const = TE_NULL;
+            virtual TextureTableType GetType() const = TE_NULL;
+    };
+
+    Ref<TextureTable> CreateTextureTable();
+}
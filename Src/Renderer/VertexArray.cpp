@@ -4,12 +4,12 @@
 
 namespace TE::Renderer
 {
-    Ref<VertexArray> TE::Renderer::CreateVertexArray()
+    Ref<VertexArray> CreateVertexArray()
     {
         switch(Renderer::GetAPI())
         {
             case RendererAPI::None:         TRIMANA_ASSERT(false, "No rendering API selected"); return nullptr;
-            case RendererAPI::OpenGL:       return Ref<TE::APIs::OpenGL::GL_VertexArray>();
+            case RendererAPI::OpenGL:       return CreateRef<TE::APIs::OpenGL::GL_VertexArray>();
             case RendererAPI::Vulkan:       TRIMANA_ASSERT(false, "Not implemented yet"); return nullptr;
             case RendererAPI::DirectX:      TRIMANA_ASSERT(false, "Not implemented yet"); return nullptr;
             default:                        return nullptr;
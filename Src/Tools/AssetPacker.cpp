@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifdef TRIMANA_WITH_LZ4
+    #include <lz4.h>
+#endif
+
+#ifdef TRIMANA_WITH_ZSTD
+    #include <zstd.h>
+#endif
+
+#include "AssetPack.hpp"
+
+using namespace TE::Core;
+
+struct PackedAsset
+{
+    String Name;
+    Path FilePath;
+    AssetPackEntry Entry;
+};
+
+static void PrintUsage()
+{
+    std::fprintf(stderr, "Usage: AssetPacker <asset directory> <output.tepk> [--lz4 | --zstd]\n");
+    std::fprintf(stderr, "  Entries are named by their path relative to the asset directory, e.g. Textures/Player.dds.\n");
+    std::fprintf(stderr, "  Compressed entries must be copied out with AssetPack::Read; leave bulk GPU data uncompressed\n");
+    std::fprintf(stderr, "  so loaders can use AssetPack::View directly on the mapping.\n");
+}
+
+static Boolean ReadFile(const Path& path, std::vector<UInt8>& data)
+{
+    std::ifstream in_file(path, std::ios::in | std::ios::binary);
+    if(!in_file)
+        return TE_FALSE;
+
+    in_file.seekg(0, std::ios::end);
+    data.resize(static_cast<size_t>(in_file.tellg()));
+    in_file.seekg(0, std::ios::beg);
+    return static_cast<Boolean>(in_file.read(reinterpret_cast<char*>(data.data()), data.size()));
+}
+
+// Only keeps the compressed form when it saves at least an eighth of the entry; otherwise the
+// decompression cost on load buys nothing over reading straight from the mapping.
+static AssetCompression Compress(AssetCompression compression, const std::vector<UInt8>& source, std::vector<UInt8>& compressed)
+{
+    size_t size = 0;
+    switch(compression)
+    {
+        #ifdef TRIMANA_WITH_LZ4
+        case AssetCompression::LZ4:
+            compressed.resize(LZ4_compressBound(static_cast<int>(source.size())));
+            size = LZ4_compress_default(reinterpret_cast<const char*>(source.data()), reinterpret_cast<char*>(compressed.data()), static_cast<int>(source.size()), static_cast<int>(compressed.size()));
+            break;
+        #endif
+
+        #ifdef TRIMANA_WITH_ZSTD
+        case AssetCompression::Zstd:
+            compressed.resize(ZSTD_compressBound(source.size()));
+            size = ZSTD_compress(compressed.data(), compressed.size(), source.data(), source.size(), 19);
+            if(ZSTD_isError(size))
+                size = 0;
+            break;
+        #endif
+
+        default:
+            return AssetCompression::None;
+    }
+
+    if(size == 0 || size > source.size() - source.size() / 8)
+        return AssetCompression::None;
+
+    compressed.resize(size);
+    return compression;
+}
+
+static void Pad(std::ofstream& out_file, UInt64& offset)
+{
+    static const char zeros[ASSET_PACK_ALIGNMENT]{};
+    UInt64 padding = (ASSET_PACK_ALIGNMENT - offset % ASSET_PACK_ALIGNMENT) % ASSET_PACK_ALIGNMENT;
+    out_file.write(zeros, padding);
+    offset += padding;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    AssetCompression compression = AssetCompression::None;
+    for(Int32 i = 3; i < argc; i++)
+    {
+        if(std::strcmp(argv[i], "--lz4") == 0)              compression = AssetCompression::LZ4;
+        else if(std::strcmp(argv[i], "--zstd") == 0)        compression = AssetCompression::Zstd;
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    #ifndef TRIMANA_WITH_LZ4
+        if(compression == AssetCompression::LZ4)
+        {
+            std::fprintf(stderr, "LZ4 support was not built in (TRIMANA_ENABLE_LZ4)\n");
+            return 1;
+        }
+    #endif
+
+    #ifndef TRIMANA_WITH_ZSTD
+        if(compression == AssetCompression::Zstd)
+        {
+            std::fprintf(stderr, "zstd support was not built in (TRIMANA_ENABLE_ZSTD)\n");
+            return 1;
+        }
+    #endif
+
+    Path root = argv[1];
+    std::vector<PackedAsset> assets;
+    std::error_code error;
+    for(auto& file : std::filesystem::recursive_directory_iterator(root, error))
+    {
+        if(!file.is_regular_file())
+            continue;
+
+        PackedAsset asset{};
+        asset.Name = std::filesystem::relative(file.path(), root).generic_string();
+        asset.FilePath = file.path();
+        asset.Entry.NameHash = HashAssetName(asset.Name);
+        assets.emplace_back(std::move(asset));
+    }
+
+    if(error || assets.empty())
+    {
+        std::fprintf(stderr, "No assets found in %s\n", argv[1]);
+        return 1;
+    }
+
+    std::sort(assets.begin(), assets.end(), [](const PackedAsset& a, const PackedAsset& b) { return a.Entry.NameHash < b.Entry.NameHash; });
+    for(size_t i = 1; i < assets.size(); i++)
+    {
+        if(assets[i - 1].Entry.NameHash == assets[i].Entry.NameHash)
+        {
+            std::fprintf(stderr, "Asset name hash collision: %s and %s\n", assets[i - 1].Name.c_str(), assets[i].Name.c_str());
+            return 1;
+        }
+    }
+
+    std::ofstream out_file(argv[2], std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!out_file)
+    {
+        std::fprintf(stderr, "Failed to open %s for writing\n", argv[2]);
+        return 1;
+    }
+
+    AssetPackHeader header{};
+    header.EntryCount = static_cast<UInt32>(assets.size());
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    UInt64 offset = sizeof(header);
+
+    String names;
+    UInt64 total_size = 0;
+    UInt64 stored_size = 0;
+    std::vector<UInt8> data;
+    std::vector<UInt8> compressed;
+    for(auto& asset : assets)
+    {
+        if(!ReadFile(asset.FilePath, data))
+        {
+            std::fprintf(stderr, "Failed to read %s\n", asset.FilePath.string().c_str());
+            return 1;
+        }
+
+        Pad(out_file, offset);
+        asset.Entry.Offset = offset;
+        asset.Entry.Size = data.size();
+        asset.Entry.Compression = Compress(compression, data, compressed);
+        const std::vector<UInt8>& blob = (asset.Entry.Compression == AssetCompression::None) ? data : compressed;
+        asset.Entry.StoredSize = blob.size();
+        out_file.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+        offset += blob.size();
+
+        asset.Entry.NameOffset = static_cast<UInt32>(names.size());
+        names.append(asset.Name);
+        names.push_back('\0');
+
+        total_size += asset.Entry.Size;
+        stored_size += asset.Entry.StoredSize;
+    }
+
+    Pad(out_file, offset);
+    header.TocOffset = offset;
+    for(auto& asset : assets)
+        out_file.write(reinterpret_cast<const char*>(&asset.Entry), sizeof(AssetPackEntry));
+    offset += assets.size() * sizeof(AssetPackEntry);
+
+    header.NamesOffset = offset;
+    header.NamesSize = static_cast<UInt32>(names.size());
+    out_file.write(names.data(), names.size());
+
+    out_file.seekp(0);
+    out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if(!out_file)
+    {
+        std::fprintf(stderr, "Failed to write %s\n", argv[2]);
+        return 1;
+    }
+
+    std::printf("%s: %zu assets, %llu bytes -> %llu bytes stored\n", argv[2], assets.size(), static_cast<unsigned long long>(total_size), static_cast<unsigned long long>(stored_size));
+    return 0;
+}
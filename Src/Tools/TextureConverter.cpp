@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <stb/stb_image.h>
+
+#include "TextureFile.hpp"
+
+using namespace TE::Renderer;
+
+struct RGBA
+{
+    UInt8 R, G, B, A;
+};
+
+struct Level
+{
+    Int32 Width;
+    Int32 Height;
+    std::vector<RGBA> Pixels;
+};
+
+static Level Downsample(const Level& source)
+{
+    Level level{ std::max(1, source.Width / 2), std::max(1, source.Height / 2), {} };
+    level.Pixels.resize(static_cast<size_t>(level.Width) * level.Height);
+    for(Int32 y = 0; y < level.Height; y++)
+    {
+        for(Int32 x = 0; x < level.Width; x++)
+        {
+            UInt32 sum[4]{};
+            for(Int32 dy = 0; dy < 2; dy++)
+            {
+                for(Int32 dx = 0; dx < 2; dx++)
+                {
+                    Int32 sx = std::min(x * 2 + dx, source.Width - 1);
+                    Int32 sy = std::min(y * 2 + dy, source.Height - 1);
+                    const RGBA& pixel = source.Pixels[sy * source.Width + sx];
+                    sum[0] += pixel.R; sum[1] += pixel.G; sum[2] += pixel.B; sum[3] += pixel.A;
+                }
+            }
+
+            level.Pixels[y * level.Width + x] = { UInt8((sum[0] + 2) / 4), UInt8((sum[1] + 2) / 4), UInt8((sum[2] + 2) / 4), UInt8((sum[3] + 2) / 4) };
+        }
+    }
+
+    return level;
+}
+
+static UInt16 ToRGB565(Int32 r, Int32 g, Int32 b)
+{
+    return static_cast<UInt16>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+}
+
+static RGBA FromRGB565(UInt16 color)
+{
+    Int32 r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+    return { UInt8((r << 3) | (r >> 2)), UInt8((g << 2) | (g >> 4)), UInt8((b << 3) | (b >> 2)), 255 };
+}
+
+// Bounding-box endpoint fit along the block's dominant axis; good enough for sprite sheets and fast.
+static void EncodeColorBlock(const RGBA block[16], UInt8* out)
+{
+    Int32 min[3] = { 255, 255, 255 }, max[3] = { 0, 0, 0 };
+    for(Int32 i = 0; i < 16; i++)
+    {
+        const UInt8 channels[3] = { block[i].R, block[i].G, block[i].B };
+        for(Int32 c = 0; c < 3; c++)
+        {
+            min[c] = std::min(min[c], Int32(channels[c]));
+            max[c] = std::max(max[c], Int32(channels[c]));
+        }
+    }
+
+    UInt16 color0 = ToRGB565(max[0], max[1], max[2]);
+    UInt16 color1 = ToRGB565(min[0], min[1], min[2]);
+    if(color0 < color1)
+        std::swap(color0, color1);
+
+    RGBA palette[4] = { FromRGB565(color0), FromRGB565(color1) };
+    palette[2] = { UInt8((2 * palette[0].R + palette[1].R) / 3), UInt8((2 * palette[0].G + palette[1].G) / 3), UInt8((2 * palette[0].B + palette[1].B) / 3), 255 };
+    palette[3] = { UInt8((palette[0].R + 2 * palette[1].R) / 3), UInt8((palette[0].G + 2 * palette[1].G) / 3), UInt8((palette[0].B + 2 * palette[1].B) / 3), 255 };
+
+    UInt32 indices = 0;
+    if(color0 != color1)
+    {
+        for(Int32 i = 0; i < 16; i++)
+        {
+            Int32 best = 0, best_error = INT32_MAX;
+            for(Int32 p = 0; p < 4; p++)
+            {
+                Int32 dr = block[i].R - palette[p].R, dg = block[i].G - palette[p].G, db = block[i].B - palette[p].B;
+                Int32 error = dr * dr + dg * dg + db * db;
+                if(error < best_error)
+                {
+                    best_error = error;
+                    best = p;
+                }
+            }
+
+            indices |= static_cast<UInt32>(best) << (i * 2);
+        }
+    }
+
+    std::memcpy(out, &color0, 2);
+    std::memcpy(out + 2, &color1, 2);
+    std::memcpy(out + 4, &indices, 4);
+}
+
+static void EncodeAlphaBlock(const RGBA block[16], UInt8* out)
+{
+    Int32 alpha0 = 0, alpha1 = 255;
+    for(Int32 i = 0; i < 16; i++)
+    {
+        alpha0 = std::max(alpha0, Int32(block[i].A));
+        alpha1 = std::min(alpha1, Int32(block[i].A));
+    }
+
+    Int32 palette[8] = { alpha0, alpha1 };
+    for(Int32 p = 1; p < 7; p++)
+        palette[p + 1] = ((7 - p) * alpha0 + p * alpha1) / 7;
+
+    UInt64 indices = 0;
+    for(Int32 i = 0; i < 16 && alpha0 != alpha1; i++)
+    {
+        Int32 best = 0, best_error = INT32_MAX;
+        for(Int32 p = 0; p < 8; p++)
+        {
+            Int32 error = std::abs(block[i].A - palette[p]);
+            if(error < best_error)
+            {
+                best_error = error;
+                best = p;
+            }
+        }
+
+        indices |= static_cast<UInt64>(best) << (i * 3);
+    }
+
+    out[0] = static_cast<UInt8>(alpha0);
+    out[1] = static_cast<UInt8>(alpha1);
+    for(Int32 b = 0; b < 6; b++)
+        out[2 + b] = static_cast<UInt8>(indices >> (b * 8));
+}
+
+static void EncodeLevel(const Level& level, TextureFormat format, std::vector<UInt8>& output)
+{
+    Int32 blocks_x = std::max(1, (level.Width + 3) / 4);
+    Int32 blocks_y = std::max(1, (level.Height + 3) / 4);
+    UInt32 block_bytes = TextureFormatBlockBytes(format);
+
+    for(Int32 by = 0; by < blocks_y; by++)
+    {
+        for(Int32 bx = 0; bx < blocks_x; bx++)
+        {
+            RGBA block[16];
+            for(Int32 i = 0; i < 16; i++)
+            {
+                Int32 x = std::min(bx * 4 + (i % 4), level.Width - 1);
+                Int32 y = std::min(by * 4 + (i / 4), level.Height - 1);
+                block[i] = level.Pixels[y * level.Width + x];
+            }
+
+            size_t offset = output.size();
+            output.resize(offset + block_bytes);
+            if(format == TextureFormat::BC3)
+            {
+                EncodeAlphaBlock(block, output.data() + offset);
+                EncodeColorBlock(block, output.data() + offset + 8);
+            }
+            else
+                EncodeColorBlock(block, output.data() + offset);
+        }
+    }
+}
+
+static void PrintUsage()
+{
+    std::printf("usage: TextureConverter <input image> <output.dds> [--bc1 | --bc3] [--no-mips] [--no-flip]\n");
+    std::printf("  Encodes an image into a DDS container with a precomputed mip chain. The format defaults to\n");
+    std::printf("  BC3 when the image has any transparency and BC1 otherwise. Images are flipped vertically by\n");
+    std::printf("  default to match CreateTexture2D(path, flip = true).\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    TextureFormat format = TextureFormat::None;
+    Boolean mips = TE_TRUE;
+    Boolean flip = TE_TRUE;
+    for(Int32 i = 3; i < argc; i++)
+    {
+        if(std::strcmp(argv[i], "--bc1") == 0)              format = TextureFormat::BC1;
+        else if(std::strcmp(argv[i], "--bc3") == 0)         format = TextureFormat::BC3;
+        else if(std::strcmp(argv[i], "--no-mips") == 0)     mips = TE_FALSE;
+        else if(std::strcmp(argv[i], "--no-flip") == 0)     flip = TE_FALSE;
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    Int32 width = 0, height = 0, channels = 0;
+    stbi_set_flip_vertically_on_load(flip);
+    UInt8* pixels = stbi_load(argv[1], &width, &height, &channels, 4);
+    if(!pixels)
+    {
+        std::fprintf(stderr, "Failed to load %s\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<Level> levels(1);
+    levels[0] = { width, height, std::vector<RGBA>(reinterpret_cast<RGBA*>(pixels), reinterpret_cast<RGBA*>(pixels) + static_cast<size_t>(width) * height) };
+    stbi_image_free(pixels);
+
+    if(format == TextureFormat::None)
+    {
+        Boolean transparent = std::any_of(levels[0].Pixels.begin(), levels[0].Pixels.end(), [](const RGBA& pixel) { return pixel.A != 255; });
+        format = transparent ? TextureFormat::BC3 : TextureFormat::BC1;
+    }
+
+    while(mips && (levels.back().Width > 1 || levels.back().Height > 1))
+        levels.push_back(Downsample(levels.back()));
+
+    std::vector<UInt8> payload;
+    for(auto& level : levels)
+        EncodeLevel(level, format, payload);
+
+    DDSHeader header{};
+    header.Flags = DDS_FLAGS_CAPS | DDS_FLAGS_HEIGHT | DDS_FLAGS_WIDTH | DDS_FLAGS_PIXELFORMAT | DDS_FLAGS_LINEARSIZE | DDS_FLAGS_MIPMAPCOUNT;
+    header.Height = static_cast<UInt32>(height);
+    header.Width = static_cast<UInt32>(width);
+    header.PitchOrLinearSize = static_cast<UInt32>(TextureLevelSize(format, width, height));
+    header.MipMapCount = static_cast<UInt32>(levels.size());
+    header.PixelFormat.Flags = DDS_PIXELFORMAT_FOURCC;
+    header.PixelFormat.FourCC = (format == TextureFormat::BC3) ? DDS_FOURCC_DXT5 : DDS_FOURCC_DXT1;
+    header.Caps[0] = DDS_CAPS_TEXTURE | (levels.size() > 1 ? DDS_CAPS_COMPLEX | DDS_CAPS_MIPMAP : 0);
+
+    FILE* file = std::fopen(argv[2], "wb");
+    if(!file)
+    {
+        std::fprintf(stderr, "Failed to open %s for writing\n", argv[2]);
+        return 1;
+    }
+
+    std::fwrite(&DDS_MAGIC, sizeof(DDS_MAGIC), 1, file);
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fwrite(payload.data(), 1, payload.size(), file);
+    std::fclose(file);
+
+    UInt64 source_bytes = static_cast<UInt64>(width) * height * 4;
+    std::printf("%s: %dx%d, %zu levels, %s, %llu -> %zu bytes\n", argv[2], width, height, levels.size(), format == TextureFormat::BC3 ? "BC3" : "BC1", static_cast<unsigned long long>(source_bytes), payload.size());
+    return 0;
+}
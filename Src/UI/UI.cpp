@@ -1,5 +1,8 @@
 #include "UI.hpp"
 #include "Renderer.hpp"
+#include "GPUProfiler.hpp"
+#include "Renderer2D.hpp"
+#include "FrameStats.hpp"
 
 namespace TE::UI
 {
@@ -358,6 +361,7 @@ namespace TE::UI
                 }
                 case TE::Renderer::RendererAPI::OpenGL:
                 {
+                    TE_GPU_PROFILE_SCOPE("UILayer::End");
                     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
                     if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
                     {
@@ -366,6 +370,7 @@ namespace TE::UI
                         ImGui::RenderPlatformWindowsDefault();
                         glfwMakeContextCurrent(backup_current_context);
                     } 
+                    TE::APIs::OpenGL::GL_StateCache::Invalidate();
                     break;
                 }
                 case TE::Renderer::RendererAPI::Vulkan:
@@ -464,6 +469,70 @@ namespace TE::UI
         m_Theme = theme;
     }
 
+    static float FrameTimeSample(void* data, int index)
+    {
+        const auto* histogram = static_cast<const TE::Core::FrameHistogram*>(data);
+        return static_cast<float>(histogram->GetSample(static_cast<UInt32>(index))) / 1000.0f;
+    }
+
+    // Call between Begin() and End().
+    void UILayer::DrawFrameStats(Boolean* open)
+    {
+        ImGui::SetNextWindowBgAlpha(0.8f);
+        if(!ImGui::Begin("Frame Stats", open, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing))
+        {
+            ImGui::End();
+            return;
+        }
+
+        const TE::Core::FrameHistogram& frames = TE::Core::FrameStats::GetHistogram(TE::Core::FrameStage::Frame);
+        if(frames.GetCount())
+        {
+            TE::Core::FrameStatsSummary frame = TE::Core::FrameStats::GetSummary(TE::Core::FrameStage::Frame);
+            ImGui::Text("%.2f ms (%.0f FPS)", frame.P50, frame.P50 > 0.0 ? 1000.0 / frame.P50 : 0.0);
+            ImGui::PlotLines("##FrameTimes", FrameTimeSample, const_cast<TE::Core::FrameHistogram*>(&frames), static_cast<int>(frames.GetCount()),
+                             0, nullptr, 0.0f, static_cast<float>(frame.P99 * 1.5), ImVec2(320.0f, 60.0f));
+        }
+
+        if(ImGui::BeginTable("##FrameStages", 7, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            for(CString header : { "Stage", "Mean", "p50", "p95", "p99", "Max", "Hitches" })
+                ImGui::TableSetupColumn(header);
+
+            ImGui::TableHeadersRow();
+            for(UInt32 i = 0; i < static_cast<UInt32>(TE::Core::FrameStage::Count); i++)
+            {
+                auto stage = static_cast<TE::Core::FrameStage>(i);
+                TE::Core::FrameStatsSummary summary = TE::Core::FrameStats::GetSummary(stage);
+                if(!summary.Samples)
+                    continue;
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(TE::Core::FrameStats::GetStageName(stage));
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.Mean);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.P50);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.P95);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.P99);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", summary.Max);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(summary.Hitches));
+            }
+
+            ImGui::EndTable();
+        }
+
+        const TE::Renderer::Renderer2D::Status& status = TE::Renderer::Renderer2D::RenderingStatus();
+        ImGui::Text("Renderer2D: %u quads, %u draw calls", status.QuadCount, status.DrawCount);
+
+        if(ImGui::Button("Reset"))
+            TE::Core::FrameStats::Reset();
+
+        ImGui::SameLine();
+        if(ImGui::Button("Export CSV"))
+            TE::Core::FrameStats::ExportCSV("FrameStats.csv");
+
+        ImGui::End();
+    }
+
     void UILayer::SetDarkTheme()
     {
         auto& colors = ImGui::GetStyle().Colors;
@@ -31,6 +31,7 @@ namespace TE::UI
             void End();
             void AllowEvents(Boolean allowEvents);
             void SetTheme(UITheme theme);
+            void DrawFrameStats(Boolean* open = nullptr);
 
         private:
             void SetDarkTheme();